@@ -0,0 +1,126 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+// Compares the RAW bytes payload with the PACKED repeated fields of ProtoVariable, see the README for how to build it.
+// Encode: MsgData -> ProtoVariable -> serialized bytes. Decode: serialized bytes -> ProtoVariable -> MsgData -> getData.
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include "../utils.h"
+
+using namespace tcp_io_device;
+
+// Keeps the compiler from dropping the decoded values.
+static volatile size_t sink;
+
+/**
+* Runs f repeatedly for about 200 ms and returns the average duration of one run in microseconds.
+*/
+template <typename F>
+static double measure(F&& f) {
+  f();
+  auto start = std::chrono::steady_clock::now();
+  int runs = 0;
+  double elapsed = 0;
+  do {
+    f();
+    ++runs;
+    elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+  } while (elapsed < 200000);
+  return elapsed / runs;
+}
+
+template <typename T>
+static void run(const char* name, VariableDescription_DataType type, size_t count) {
+  std::vector<T> values(count);
+  for (size_t i = 0; i < count; ++i) {
+    values[i] = (T)(i % 7 == 0 ? i * 3 : i % 2);
+  }
+  for (VariableDescription_Encoding encoding : { VariableDescription_Encoding_RAW, VariableDescription_Encoding_PACKED }) {
+    MetaData meta_data(1, 1, type, { count });
+    meta_data.setEncoding(encoding);
+    MsgData msg_data = MsgData::createNewMsgData(meta_data);
+    msg_data.setData(values);
+    std::string wire;
+    double encode = measure([&] {
+      ProtoVariable var;
+      msg_data.toMutableProtoVariable(&var);
+      var.SerializeToString(&wire);
+      });
+    double decode = measure([&] {
+      ProtoVariable var;
+      var.ParseFromString(wire);
+      MsgData received(&var);
+      sink = received.getData<T>().size();
+      });
+    std::cout << std::left << std::setw(8) << name << std::setw(8) << VariableDescription_Encoding_Name(encoding)
+      << std::right << std::setw(10) << count << std::setw(12) << wire.size()
+      << std::setw(12) << std::fixed << std::setprecision(1) << encode
+      << std::setw(12) << decode << std::endl;
+  }
+}
+
+int main() {
+  std::cout << std::left << std::setw(8) << "type" << std::setw(8) << "layout" << std::right << std::setw(10) << "values"
+    << std::setw(12) << "bytes" << std::setw(12) << "encode us" << std::setw(12) << "decode us" << std::endl;
+  for (size_t count : { (size_t)1000, (size_t)1000000 }) {
+    run<double>("DOUBLE", VariableDescription_DataType_DOUBLE, count);
+    run<int64_t>("INT64", VariableDescription_DataType_INT64, count);
+    run<bool>("BOOL", VariableDescription_DataType_BOOL, count);
+  }
+  return 0;
+}
@@ -0,0 +1,119 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+// Checks that the CommandTemplates write byte for byte what protobuf serializes for the same command, see the README
+// for how to build it.
+
+#include <string>
+#include <vector>
+#include "../command_template.h"
+#include "check.h"
+
+using namespace tcp_io_device;
+
+static void addCommand(SetupMessage& setup, const char* name, int entity_id, int id, VariableDescription_DataType type,
+  std::vector<uint64_t> dimensions, const char* opcode, VariableDescription_Encoding encoding) {
+  CommandDescription* command = setup.add_commanddescriptions();
+  command->set_name(name);
+  VariableDescription* description = command->mutable_description();
+  description->set_entityid(entity_id);
+  description->set_id(id);
+  description->set_datatype(type);
+  for (uint64_t dimension : dimensions) {
+    description->add_dimensions(dimension);
+  }
+  description->set_opcode_string_handle(opcode);
+  description->set_encoding(encoding);
+}
+
+int main() {
+  SetupMessage setup;
+  addCommand(setup, "move", 1, 2, VariableDescription_DataType_DOUBLE, { 3 }, "mv", VariableDescription_Encoding_RAW);
+  addCommand(setup, "grab", -3, 700, VariableDescription_DataType_INT64, { 1 }, "", VariableDescription_Encoding_PACKED);
+  addCommand(setup, "say", 4, 5, VariableDescription_DataType_STRING, {}, "say", VariableDescription_Encoding_RAW);
+  addCommand(setup, "big", 4, 6, VariableDescription_DataType_FLOAT, { 100, 50 }, "", VariableDescription_Encoding_RAW);
+  CommandTemplateCache cache(setup);
+  CHECK(cache.getTemplates().size() == 4);
+  CHECK(cache.find("grab") != NULL && cache.find("grab") == cache.find(-3, 700));
+  CHECK(cache.find("nope") == NULL);
+
+  for (const CommandTemplate& command : cache.getTemplates()) {
+    // The size of the description (the pre-encoded case), no data, and a size other than described.
+    for (size_t size : { (size_t)command.getMetaData().getDataSize(), (size_t)0, (size_t)200 }) {
+      for (uint64_t time_span : { 0ull, 9ull, 1ull << 35 }) {
+        for (uint64_t timestamp : { 0ull, 123456789ull }) {
+          std::string payload(size, '\0');
+          for (size_t i = 0; i < size; ++i) {
+            payload[i] = (char)i;
+          }
+          TCPMessage msg;
+          msg.set_messagetype(TCPMessage_Type_DATA);
+          msg.set_timestamp(timestamp);
+          msg.mutable_datamessage()->set_timespan(time_span);
+          ProtoVariable* var = msg.mutable_datamessage()->add_variables();
+          MetaData meta_data = command.getMetaData();
+          meta_data.toMutableVariableDescription(var->mutable_metadata());
+          var->set_data(payload);
+
+          // Appended after what is already in the buffer.
+          std::string encoded = "x";
+          command.encode(payload.data(), size, time_span, timestamp, encoded);
+          CHECK(encoded == "x" + msg.SerializeAsString());
+        }
+      }
+    }
+  }
+  return checks::result("command_template_check");
+}
@@ -0,0 +1,109 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+// Round trips frames through the LZ4 and zstd frame compression of TCPConnection and makes sure corrupt frames are
+// rejected, see the README for how to build it.
+
+#include <string>
+#include "../tcp_connection.h"
+#include "check.h"
+
+using namespace tcp_io_device;
+
+// Gives access to the protected compression functions.
+struct CompressionAccess : TCPConnection {
+  using TCPConnection::compressFrame;
+  using TCPConnection::decompressFrame;
+};
+
+static void roundTrip(StartMessage_Compression compression, uint8_t flags, const std::string& frame) {
+  std::string compressed;
+  CHECK(CompressionAccess::compressFrame(compression, frame, compressed));
+  AlignedBuffer decompressed;
+  uint64_t size = 0;
+  CHECK(CompressionAccess::decompressFrame(flags, compressed.data(), compressed.size(), decompressed, size));
+  CHECK(size == frame.size() && std::string(decompressed.data(), size) == frame);
+
+  // A corrupt size or payload must be rejected, or at least not overrun the buffer.
+  std::string corrupt = compressed;
+  corrupt[3] ^= 0x01;
+  corrupt[corrupt.size() / 2] ^= 0x55;
+  if (CompressionAccess::decompressFrame(flags, corrupt.data(), corrupt.size(), decompressed, size)) {
+    CHECK(size <= decompressed.size());
+  }
+  CHECK(!CompressionAccess::decompressFrame(flags, compressed.data(), 4, decompressed, size));
+}
+
+int main() {
+  std::string frame;
+  for (int i = 0; i < 100000; ++i) {
+    frame += (char)("abcabd"[i % 6] + (i % 97 == 0));
+  }
+  std::vector<StartMessage_Compression> supported = TCPConnection::supportedCompressions();
+  for (StartMessage_Compression compression : supported) {
+    if (compression == StartMessage_Compression_LZ4) {
+      roundTrip(compression, FRAME_LZ4, frame);
+      roundTrip(compression, FRAME_LZ4, "");
+    }
+    if (compression == StartMessage_Compression_ZSTD) {
+      roundTrip(compression, FRAME_ZSTD, frame);
+      roundTrip(compression, FRAME_ZSTD, "");
+    }
+  }
+  if (supported.empty()) {
+    std::cout << "Neither ENABLE_LZ4 nor ENABLE_ZSTD is defined, nothing to check." << std::endl;
+  }
+  return checks::result("compression_check");
+}
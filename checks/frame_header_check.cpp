@@ -0,0 +1,98 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+// Checks the wire layout of the FrameHeader and that it is told apart from the legacy length prefix, see the README
+// for how to build it.
+
+#include <cstring>
+#include <string>
+#include "../frame_header.h"
+#include "check.h"
+
+using namespace tcp_io_device;
+
+int main() {
+  FrameHeader header;
+  header.type = 3;
+  header.flags = FRAME_ZSTD | FRAME_DELTA;
+  header.length = 0x0102030405060708ull;
+  header.sequence = 42;
+  header.timestamp = 1ull << 62;
+  std::string wire;
+  header.write(wire);
+  CHECK(wire.size() == FrameHeader::SIZE);
+  CHECK(wire.compare(0, 4, "AERA") == 0 && (uint8_t)wire[4] == FrameHeader::VERSION);
+  CHECK(wire[5] == 3 && wire[6] == (FRAME_ZSTD | FRAME_DELTA) && wire[7] == 0);
+  // Little endian, independent of the host.
+  CHECK(wire[8] == 0x08 && wire[15] == 0x01 && wire[16] == 42);
+
+  FrameHeader read;
+  CHECK(read.read(wire.data()));
+  CHECK(read.version == header.version && read.type == header.type && read.flags == header.flags);
+  CHECK(read.length == header.length && read.sequence == header.sequence && read.timestamp == header.timestamp);
+
+  // Legacy length prefixes, with and without compression flags in the most significant byte, are no header.
+  for (uint64_t length : { 0ull, 16ull, 1ull << 31, (1ull << 56) | 100, (2ull << 56) | 0xFFFFFFFFull }) {
+    char prefix[8];
+    for (int i = 0; i < 8; ++i) {
+      prefix[i] = (char)(length >> (i * 8));
+    }
+    CHECK(!FrameHeader::detect(prefix));
+  }
+  std::string other_version = wire;
+  other_version[4] = (char)(FrameHeader::VERSION + 1);
+  CHECK(!read.read(other_version.data()));
+  return checks::result("frame_header_check");
+}
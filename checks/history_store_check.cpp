@@ -0,0 +1,133 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+// Checks the window queries of the HistoryStore, also while the writer keeps appending, see the README for how to
+// build it.
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include "../history_store.h"
+#include "check.h"
+
+using namespace tcp_io_device;
+
+int main() {
+  SetupMessage setup;
+  (*setup.mutable_entities())["a"] = 1;
+  (*setup.mutable_objects())["x"] = 2;
+  (*setup.mutable_objects())["v"] = 3;
+  (*setup.mutable_objects())["n"] = 4;
+  HistoryStore history(100);
+  history.onSetup(std::make_shared<SetupTables>(setup));
+  MetaData x(1, 2, VariableDescription_DataType_DOUBLE, { 1 });
+  MetaData v(1, 3, VariableDescription_DataType_FLOAT, { 3 });
+  MetaData n(1, 4, VariableDescription_DataType_STRING, { 2 });
+
+  // DataMessage k holds x = k and v = { k, 2k, -1 }. A reader checks that the windows it gets are consistent.
+  std::atomic<bool> stop{ false };
+  std::atomic<int> inconsistent{ 0 };
+  std::thread reader([&] {
+    while (!stop) {
+      WindowStats stats;
+      if (history.getLastStats(1, 2, 10, stats) && (stats.max - stats.min != stats.count - 1 || stats.mean != (stats.max + stats.min) / 2)) {
+        inconsistent++;
+      }
+      HistoryView view = history.getLast(1, 3, 5);
+      for (size_t i = 0; i < view.size(); ++i) {
+        if (view.get<float>(i, 1) != 2 * view.get<float>(i, 0)) {
+          inconsistent++;
+        }
+      }
+    }
+    });
+  for (int k = 0; k < 250; ++k) {
+    double value = k;
+    history.onVariable(x, (const char*)&value, sizeof(value));
+    float values[3] = { (float)k, 2.0f * k, -1 };
+    history.onVariable(v, (const char*)values, sizeof(values));
+    history.onVariable(n, "hi", 2);
+    history.onDataMessageEnd(5, 1000 + k);
+  }
+  stop = true;
+  reader.join();
+  CHECK(inconsistent == 0);
+
+  // The ring keeps the last 100 DataMessages, 150 to 249.
+  WindowStats stats;
+  CHECK(history.getLastStats(1, 2, 10, stats) && stats.count == 10 && stats.min == 240 && stats.max == 249 && stats.mean == 244.5);
+  CHECK(history.getWindowStats(1, 2, 1200, 1210, stats) && stats.count == 10 && stats.min == 200 && stats.max == 209);
+  CHECK(history.getWindowStats(1, 2, 0, UINT64_MAX, stats) && stats.count == 100 && stats.min == 150);
+  CHECK(!history.getWindowStats(1, 2, 0, 1100, stats));
+  // Statistics of the second value of v.
+  CHECK(history.getLastStats(1, 3, 100, stats, 1) && stats.min == 300 && stats.max == 498);
+  // No statistics of strings, values out of range or unknown variables.
+  CHECK(!history.getLastStats(1, 4, 3, stats));
+  CHECK(!history.getLastStats(1, 3, 3, stats, 3));
+  CHECK(!history.getLastStats(9, 9, 3, stats));
+
+  // A window across the end of the ring comes in two segments.
+  HistoryView window = history.getWindow(1, 2, 1180, 1260);
+  const double* first = NULL;
+  const double* second = NULL;
+  size_t first_count = 0;
+  size_t second_count = 0;
+  window.getSegments<double>(0, first, first_count, second, second_count);
+  CHECK(window.size() == 70 && first_count + second_count == 70);
+  CHECK(first_count > 0 && first[0] == 180);
+  CHECK(second_count == 0 || second[second_count - 1] == 249);
+  CHECK(window.getTimestamp(0) == 1180 && window.getTimeSpan(0) == 5);
+  return checks::result("history_store_check");
+}
@@ -0,0 +1,131 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+// Checks that LazyMessage borrows RAW payloads from the received frame and gives the same values and the same message
+// as a full protobuf parse, see the README for how to build it.
+
+#include <memory>
+#include <string>
+#include "../lazy_message.h"
+#include "check.h"
+
+using namespace tcp_io_device;
+
+int main() {
+  TCPMessage msg;
+  msg.set_messagetype(TCPMessage_Type_DATA);
+  msg.set_timestamp(77);
+  DataMessage* data_msg = msg.mutable_datamessage();
+  data_msg->set_timespan(5);
+  // A large RAW DOUBLE variable, a PACKED one and a RAW BYTES variable.
+  for (int k = 0; k < 3; ++k) {
+    ProtoVariable* var = data_msg->add_variables();
+    var->mutable_metadata()->set_entityid(k);
+    var->mutable_metadata()->set_datatype(k == 2 ? VariableDescription_DataType_BYTES : VariableDescription_DataType_DOUBLE);
+    var->mutable_metadata()->add_dimensions(100000);
+    if (k == 1) {
+      var->mutable_metadata()->set_encoding(VariableDescription_Encoding_PACKED);
+      for (int i = 0; i < 10; ++i) {
+        var->add_doubledata(i);
+      }
+      continue;
+    }
+    std::string values(k == 2 ? 100000 : 800000, '\0');
+    for (size_t i = 0; i < values.size(); ++i) {
+      values[i] = (char)(i * 7 + k);
+    }
+    var->set_data(values);
+  }
+  std::string wire = msg.SerializeAsString();
+  TCPMessage full;
+  full.ParseFromString(wire);
+
+  std::shared_ptr<AlignedBuffer> frame = std::make_shared<AlignedBuffer>();
+  frame->assign(wire.data(), wire.size());
+  std::unique_ptr<LazyMessage> lazy = LazyMessage::parse(frame, frame->data(), frame->size());
+  CHECK(lazy != nullptr);
+  if (!lazy) {
+    return checks::result("lazy_message_check");
+  }
+  CHECK(lazy->getMessage().timestamp() == 77);
+  CHECK(lazy->getMessage().datamessage().timespan() == 5);
+  CHECK(lazy->getMessage().datamessage().variables_size() == 3);
+  for (int k = 0; k < 3; ++k) {
+    const ProtoVariable* var = &lazy->getMessage().datamessage().variables(k);
+    MsgData lazy_data = lazy->getMsgData(var);
+    MsgData full_data(&full.datamessage().variables(k));
+    CHECK(lazy_data._data() == full_data._data());
+    // The BYTES payload stays in the frame, the PACKED values are parsed into the message. The DOUBLE payload is only
+    // borrowed if it happens to be aligned for double in the frame.
+    if (k != 0) {
+      CHECK(lazy_data.isBorrowed() == (k == 2));
+    }
+  }
+
+  // Changing the data copies it, the frame and other views on it are not written.
+  {
+    MsgData borrowed = lazy->getMsgData(&lazy->getMessage().datamessage().variables(2));
+    MsgData copy = borrowed;
+    CHECK(copy.isBorrowed());
+    copy.setData(std::vector<char>{ 1, 2 });
+    CHECK(!copy.isBorrowed() && borrowed.isBorrowed());
+    CHECK(std::string(frame->data(), frame->size()) == wire);
+  }
+
+  CHECK(lazy->materialize()->SerializeAsString() == wire);
+  std::string truncated = wire.substr(0, wire.size() - 10);
+  CHECK(LazyMessage::parse(frame, truncated.data(), truncated.size()) == nullptr);
+  return checks::result("lazy_message_check");
+}
@@ -0,0 +1,159 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+// Checks that the fast path of the SchemaDecoder delivers the same variables as the protobuf fallback and rejects what
+// it can not decode, see the README for how to build it.
+
+#include <string>
+#include <vector>
+#include "../schema_decoder.h"
+#include "check.h"
+
+using namespace tcp_io_device;
+
+// Records everything delivered, to compare the fast path with the fallback.
+struct RecordingSink : VariableSink {
+  std::vector<std::string> delivered;
+
+  void onVariable(const MetaData& meta_data, const char* data, size_t size) override {
+    delivered.push_back(std::to_string(meta_data.getEntityID()) + "/" + std::to_string(meta_data.getID()) + ":" +
+      std::string(data, size));
+  }
+
+  void onDataMessageEnd(uint64_t time_span, uint64_t timestamp) override {
+    delivered.push_back("end " + std::to_string(time_span) + " " + std::to_string(timestamp));
+  }
+};
+
+static void addVariable(DataMessage* data_msg, int count, double value, VariableDescription_Encoding encoding) {
+  ProtoVariable* var = data_msg->add_variables();
+  var->mutable_metadata()->set_entityid(1);
+  var->mutable_metadata()->set_id(2);
+  var->mutable_metadata()->set_datatype(VariableDescription_DataType_DOUBLE);
+  var->mutable_metadata()->add_dimensions(count);
+  var->mutable_metadata()->set_encoding(encoding);
+  std::vector<double> values(count, value);
+  if (encoding == VariableDescription_Encoding_PACKED) {
+    for (double v : values) {
+      var->add_doubledata(v);
+    }
+  }
+  else {
+    var->set_data(std::string((const char*)values.data(), values.size() * sizeof(double)));
+  }
+}
+
+static TCPMessage dataMessage(int count, double value, VariableDescription_Encoding encoding = VariableDescription_Encoding_RAW) {
+  TCPMessage msg;
+  msg.set_messagetype(TCPMessage_Type_DATA);
+  msg.set_timestamp(9);
+  msg.mutable_datamessage()->set_timespan(3);
+  addVariable(msg.mutable_datamessage(), count, value, encoding);
+  return msg;
+}
+
+/**
+* Decodes msg with the fast path and with the fallback of a second decoder and returns true if both delivered the same.
+*/
+static bool sameAsFallback(SchemaDecoder& decoder, const TCPMessage& msg, TCPMessage_ByteOrder byte_order) {
+  std::string wire = msg.SerializeAsString();
+  RecordingSink fast;
+  RecordingSink fallback;
+  SchemaDecoder fallback_decoder;
+  if (!decoder.decode(wire.data(), wire.size(), byte_order, fast)) {
+    return false;
+  }
+  fallback_decoder.decode(msg, byte_order, fallback);
+  return !fast.delivered.empty() && fast.delivered == fallback.delivered;
+}
+
+int main() {
+  SchemaDecoder decoder;
+  CHECK(sameAsFallback(decoder, dataMessage(4, 1.5), hostByteOrder()));
+  // Same description again, the interned MetaData is used.
+  CHECK(sameAsFallback(decoder, dataMessage(4, 2.5), hostByteOrder()));
+  // Other dimensions are interned again.
+  CHECK(sameAsFallback(decoder, dataMessage(6, 3.5), hostByteOrder()));
+  // Values of the other byte order are swapped.
+  CHECK(sameAsFallback(decoder, dataMessage(6, 1.0), hostByteOrder() == TCPMessage_ByteOrder_LITTLE ?
+    TCPMessage_ByteOrder_BIG : TCPMessage_ByteOrder_LITTLE));
+
+  TCPMessage batch;
+  batch.set_messagetype(TCPMessage_Type_BATCH);
+  batch.set_timestamp(10);
+  for (int i = 0; i < 3; ++i) {
+    DataMessage* data_msg = batch.mutable_batchmessage()->add_datamessages();
+    data_msg->set_timespan(i);
+    addVariable(data_msg, 4, i, VariableDescription_Encoding_RAW);
+    batch.mutable_batchmessage()->add_timestamps(100 + i);
+  }
+  CHECK(sameAsFallback(decoder, batch, hostByteOrder()));
+  CHECK(decoder.getFastFrames() == 5 && decoder.getFallbackFrames() == 0);
+
+  // Rejected before anything is delivered: packed fields, other message types and truncated frames.
+  RecordingSink rejected;
+  std::string packed = dataMessage(4, 4.5, VariableDescription_Encoding_PACKED).SerializeAsString();
+  CHECK(!decoder.decode(packed.data(), packed.size(), hostByteOrder(), rejected));
+  TCPMessage setup;
+  setup.set_messagetype(TCPMessage_Type_SETUP);
+  std::string setup_wire = setup.SerializeAsString();
+  CHECK(!decoder.decode(setup_wire.data(), setup_wire.size(), hostByteOrder(), rejected));
+  std::string truncated = dataMessage(4, 1.5).SerializeAsString();
+  truncated.resize(truncated.size() - 3);
+  CHECK(!decoder.decode(truncated.data(), truncated.size(), hostByteOrder(), rejected));
+  CHECK(rejected.delivered.empty());
+  CHECK(decoder.getFallbackFrames() == 3);
+  return checks::result("schema_decoder_check");
+}
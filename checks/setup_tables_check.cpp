@@ -0,0 +1,105 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+// Checks the lookup tables and variable slots built from a SetupMessage, see the README for how to build it.
+
+#include <climits>
+#include <vector>
+#include "../utils.h"
+#include "check.h"
+
+using namespace tcp_io_device;
+
+int main() {
+  SetupMessage setup;
+  (*setup.mutable_entities())["robot"] = 3;
+  (*setup.mutable_entities())["cube"] = 1000000;
+  (*setup.mutable_entities())["ball"] = -7;
+  (*setup.mutable_objects())["position"] = 10;
+  (*setup.mutable_objects())["color"] = 11;
+  (*setup.mutable_commands())["move"] = 20;
+  SetupTables tables(setup);
+
+  int id = 0;
+  CHECK(tables.getEntities().find("cube", id) && id == 1000000);
+  CHECK(!tables.getEntities().find("nope", id));
+  CHECK(tables.getEntities().findName(-7) != NULL && *tables.getEntities().findName(-7) == "ball");
+  CHECK(tables.getObjects().findName(12) == NULL);
+
+  // One slot for every pair of an entity and an object or command ID, each pair in its own slot.
+  CHECK(tables.getSlotCount() == 9);
+  std::vector<bool> used(tables.getSlotCount());
+  for (int entity_id : { 3, 1000000, -7 }) {
+    for (int object_id : { 10, 11, 20 }) {
+      int slot = tables.getSlot(entity_id, object_id);
+      CHECK(slot >= 0 && slot < (int)used.size() && !used[slot]);
+      CHECK(tables.getEntityID(slot) == entity_id && tables.getID(slot) == object_id);
+      if (slot >= 0 && slot < (int)used.size()) {
+        used[slot] = true;
+      }
+    }
+  }
+  CHECK(tables.getSlot(4, 10) == -1);
+  CHECK(tables.getSlot(3, 12) == -1);
+  CHECK(tables.getSlot(MetaData(1000000, 11, VariableDescription_DataType_DOUBLE, { 1 })) >= 0);
+
+  // Compact and sparse ID ranges, including the limits of int32.
+  DenseIndex compact({ 5, 6, 5, 9 });
+  CHECK(compact.size() == 3 && compact.indexOf(9) == 2 && compact.indexOf(7) == -1);
+  CHECK(compact.indexOf(INT_MIN) == -1 && compact.indexOf(INT_MAX) == -1);
+  DenseIndex sparse({ INT_MIN, 0, INT_MAX });
+  CHECK(sparse.size() == 3 && sparse.indexOf(INT_MAX) == 2 && sparse.indexOf(INT_MIN) == 0 && sparse.indexOf(1) == -1);
+  return checks::result("setup_tables_check");
+}
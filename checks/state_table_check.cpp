@@ -0,0 +1,166 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+// Checks that StateTable snapshots taken by reader threads always show whole DataMessages while the writer keeps
+// publishing and replacing the layout, see the README for how to build it.
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../state_table.h"
+#include "check.h"
+
+using namespace tcp_io_device;
+
+static const int kObjects = 50;
+
+/**
+* Writes DataMessage k: every slot of entity e gets the values { k * e, k }.
+*/
+static void writeMessage(StateTable& table, uint64_t k) {
+  for (int entity_id : { 1, 2 }) {
+    for (int i = 0; i < kObjects; ++i) {
+      uint64_t values[2] = { k * entity_id, k };
+      table.onVariable(MetaData(entity_id, 100 + i, VariableDescription_DataType_UINT64, { 2 }), (const char*)values, sizeof(values));
+    }
+  }
+  table.onDataMessageEnd(1, k);
+}
+
+int main() {
+  SetupMessage setup;
+  (*setup.mutable_entities())["a"] = 1;
+  (*setup.mutable_entities())["b"] = 2;
+  for (int i = 0; i < kObjects; ++i) {
+    (*setup.mutable_objects())["o" + std::to_string(i)] = 100 + i;
+  }
+  std::shared_ptr<SetupTables> tables = std::make_shared<SetupTables>(setup);
+  StateTable table(16);
+  StateSnapshot snapshot;
+  table.snapshot(snapshot);
+  CHECK(snapshot.getSlotCount() == 0);
+  table.onSetup(tables);
+
+  // Readers check that all slots of a snapshot come from the same DataMessage.
+  std::atomic<bool> stop{ false };
+  std::atomic<int> torn{ 0 };
+  std::atomic<int> snapshots{ 0 };
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 2; ++r) {
+    readers.emplace_back([&] {
+      StateSnapshot snap;
+      while (!stop) {
+        table.snapshot(snap);
+        snapshots++;
+        const SetupTables* snap_tables = snap.getSetupTables().get();
+        if (!snap_tables || !snap.hasValue(0)) {
+          continue;
+        }
+        uint64_t k = snap.getTimestamp(0);
+        for (int entity_id : { 1, 2 }) {
+          for (int i = 0; i < kObjects; ++i) {
+            int slot = snap_tables->getSlot(entity_id, 100 + i);
+            if (!snap.hasValue(slot) || snap.getData<uint64_t>(slot)[0] != k * entity_id || snap.getTimestamp(slot) != k) {
+              torn++;
+            }
+          }
+        }
+      }
+      });
+  }
+  for (uint64_t k = 1; k <= 5000; ++k) {
+    // A new SetupMessage now and then replaces the layout under the readers.
+    if (k % 250 == 0) {
+      table.onSetup(std::make_shared<SetupTables>(setup));
+    }
+    writeMessage(table, k);
+  }
+  stop = true;
+  for (std::thread& reader : readers) {
+    reader.join();
+  }
+  CHECK(torn == 0);
+  CHECK(snapshots > 0);
+  // Replaced layouts are freed once no reader is left that may copy from them.
+  table.onDataMessageEnd(0, 0);
+  table.onDataMessageEnd(0, 0);
+  CHECK(table.getRetiredLayouts() == 0);
+
+  // Variables too large for a slot or of unknown entities are dropped.
+  uint64_t large[3] = {};
+  table.onVariable(MetaData(1, 100, VariableDescription_DataType_UINT64, { 3 }), (const char*)large, sizeof(large));
+  table.onVariable(MetaData(3, 100, VariableDescription_DataType_UINT64, { 1 }), (const char*)large, 8);
+  CHECK(table.getDroppedVariables() == 2);
+
+  // A partial update keeps the values of the other slots.
+  uint64_t values[2] = { 7, 7 };
+  table.onVariable(MetaData(1, 101, VariableDescription_DataType_UINT64, { 2 }), (const char*)values, sizeof(values));
+  table.onDataMessageEnd(0, 5001);
+  table.snapshot(snapshot);
+  int updated = tables->getSlot(1, 101);
+  int kept = tables->getSlot(2, 149);
+  CHECK(snapshot.getData<uint64_t>(updated)[0] == 7 && snapshot.getTimestamp(updated) == 5001);
+  CHECK(snapshot.getData<uint64_t>(kept)[0] == 10000 && snapshot.getTimestamp(kept) == 5000);
+  CHECK(snapshot.getVersion(kept) > 0 && snapshot.getDataSize(kept) == 16 && snapshot.getTimeSpan(kept) == 1);
+  CHECK(snapshot.getType(kept) == VariableDescription_DataType_UINT64);
+
+  // A new SetupMessage starts with empty slots.
+  table.onSetup(std::make_shared<SetupTables>(setup));
+  table.snapshot(snapshot);
+  CHECK(!snapshot.hasValue(kept));
+  return checks::result("state_table_check");
+}
@@ -0,0 +1,151 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+// Checks the decimation, rate limit and change-only rules of the SubscriptionFilter, see the README for how to build it.
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../subscription_filter.h"
+#include "check.h"
+
+using namespace tcp_io_device;
+
+static Subscription* subscribe(SubscriptionMessage& msg, int entity_id, int id) {
+  Subscription* subscription = msg.add_subscriptions();
+  subscription->set_entityid(entity_id);
+  subscription->set_id(id);
+  return subscription;
+}
+
+int main() {
+  SubscriptionFilter filter;
+  MetaData decimated(1, 2, VariableDescription_DataType_DOUBLE, { 2 });
+  MetaData change_only(1, 3, VariableDescription_DataType_DOUBLE, { 2 });
+  MetaData rate_limited(2, 1, VariableDescription_DataType_INT32, { 1 });
+  MetaData other(5, 5, VariableDescription_DataType_DOUBLE, { 2 });
+  double values[2] = { 1, 2 };
+  // Everything is sent without a subscription.
+  CHECK(filter.accepts(decimated, (const char*)values, sizeof(values), 0));
+
+  SubscriptionMessage msg;
+  subscribe(msg, 1, 2)->set_decimation(3);
+  Subscription* changes = subscribe(msg, 1, 3);
+  changes->set_changeonly(true);
+  changes->set_deadband(0.5);
+  changes->set_maxinterval(100);
+  subscribe(msg, 2, 1)->set_mininterval(10);
+  filter.setSubscription(msg);
+
+  // Every third sample, and nothing that is not subscribed.
+  int sent = 0;
+  for (int t = 0; t < 9; ++t) {
+    sent += filter.accepts(decimated, (const char*)values, sizeof(values), t);
+  }
+  CHECK(sent == 3);
+  CHECK(!filter.accepts(other, (const char*)values, sizeof(values), 0));
+
+  // Changes beyond the dead band, NaN changes once, unchanged values again after maxInterval.
+  double sample[2] = { 1, 1 };
+  CHECK(filter.accepts(change_only, (const char*)sample, sizeof(sample), 0));
+  sample[0] = 1.4;
+  CHECK(!filter.accepts(change_only, (const char*)sample, sizeof(sample), 1));
+  sample[0] = 1.6;
+  CHECK(filter.accepts(change_only, (const char*)sample, sizeof(sample), 2));
+  sample[1] = NAN;
+  CHECK(filter.accepts(change_only, (const char*)sample, sizeof(sample), 3));
+  CHECK(!filter.accepts(change_only, (const char*)sample, sizeof(sample), 4));
+  CHECK(filter.accepts(change_only, (const char*)sample, sizeof(sample), 103));
+  // Integers are compared exactly, also at the limits of the type.
+  MetaData change_only_int(1, 3, VariableDescription_DataType_INT64, { 1 });
+  int64_t value = INT64_MAX;
+  CHECK(filter.accepts(change_only_int, (const char*)&value, sizeof(value), 200));
+  value = INT64_MAX - 1;
+  CHECK(filter.accepts(change_only_int, (const char*)&value, sizeof(value), 201));
+  CHECK(!filter.accepts(change_only_int, (const char*)&value, sizeof(value), 202));
+
+  // At most one sample every 10 time units: 0, 12, 24, 36 and 48.
+  int32_t count = 1;
+  sent = 0;
+  for (int t = 0; t < 50; t += 3) {
+    sent += filter.accepts(rate_limited, (const char*)&count, sizeof(count), t);
+  }
+  CHECK(sent == 5);
+
+  // The DataMessage and MsgData variants, with the variables that are not subscribed passed through.
+  msg.set_includeothers(true);
+  filter.setSubscription(msg);
+  DataMessage data_msg;
+  for (int id : { 2, 3, 9 }) {
+    ProtoVariable* var = data_msg.add_variables();
+    var->mutable_metadata()->set_entityid(1);
+    var->mutable_metadata()->set_id(id);
+    var->mutable_metadata()->add_dimensions(2);
+    var->set_data(std::string((const char*)values, sizeof(values)));
+  }
+  CHECK(filter.select(&data_msg, 0) == 3);
+  CHECK(filter.select(&data_msg, 1) == 1 && data_msg.variables(0).metadata().id() == 9);
+  std::vector<MsgData> variables;
+  variables.push_back(MsgData::createNewMsgData(change_only, std::string((const char*)values, sizeof(values))));
+  variables.push_back(MsgData::createNewMsgData(decimated, std::string((const char*)values, sizeof(values))));
+  filter.setSubscription(msg);
+  CHECK(filter.select(variables, 0) == 2);
+  CHECK(filter.select(variables, 1) == 0);
+
+  filter.reset();
+  CHECK(filter.accepts(other, (const char*)values, sizeof(values), 0));
+  return checks::result("subscription_filter_check");
+}
@@ -0,0 +1,148 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+// Checks that the VariableFilter drops the same variables in LazyMessage and in both paths of the SchemaDecoder, see the
+// README for how to build it.
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "../lazy_message.h"
+#include "../schema_decoder.h"
+#include "check.h"
+
+using namespace tcp_io_device;
+
+// Records the IDs of the delivered variables.
+struct IdSink : VariableSink {
+  std::vector<int> ids;
+
+  void onVariable(const MetaData& meta_data, const char* /*data*/, size_t /*size*/) override { ids.push_back(meta_data.getID()); }
+};
+
+static void addVariable(DataMessage* data_msg, int entity_id, int id, double value) {
+  ProtoVariable* var = data_msg->add_variables();
+  VariableDescription* description = var->mutable_metadata();
+  description->set_entityid(entity_id);
+  description->set_id(id);
+  description->set_datatype(VariableDescription_DataType_DOUBLE);
+  description->add_dimensions(1);
+  var->set_data(std::string((const char*)&value, sizeof(value)));
+}
+
+int main() {
+  // Variable i belongs to entity 1 + i % 2.
+  TCPMessage msg;
+  msg.set_messagetype(TCPMessage_Type_DATA);
+  for (int i = 0; i < 6; ++i) {
+    addVariable(msg.mutable_datamessage(), 1 + i % 2, i, i * 1.5);
+  }
+  std::string wire = msg.SerializeAsString();
+
+  // Explicit pairs in LazyMessage.
+  VariableFilter pairs;
+  pairs.add(1, 0);
+  pairs.add(2, 3);
+  pairs.add(1, 4);
+  std::unique_ptr<LazyMessage> lazy = LazyMessage::parse(NULL, wire.data(), wire.size(), &pairs);
+  CHECK(lazy != nullptr);
+  if (lazy) {
+    std::unique_ptr<TCPMessage> kept = lazy->materialize();
+    CHECK(kept->datamessage().variables_size() == 3);
+    CHECK(kept->datamessage().variables(1).metadata().id() == 3);
+    CHECK(MsgData(&kept->datamessage().variables(1)).getData<double>() == std::vector<double>{ 4.5 });
+  }
+  CHECK(pairs.getFilteredVariables() == 3);
+
+  // A predicate is evaluated once per description, and again when the description changes.
+  int calls = 0;
+  VariableFilter predicate;
+  predicate.setPredicate([&](const MetaData& meta_data) {
+    calls++;
+    return meta_data.getEntityID() == 2;
+    });
+  for (int k = 0; k < 3; ++k) {
+    lazy = LazyMessage::parse(NULL, wire.data(), wire.size(), &predicate);
+    CHECK(lazy && lazy->getMessage().datamessage().variables_size() == 3);
+  }
+  CHECK(calls == 6);
+  TCPMessage changed = msg;
+  changed.mutable_datamessage()->mutable_variables(1)->mutable_metadata()->set_entityid(1);
+  std::string changed_wire = changed.SerializeAsString();
+  lazy = LazyMessage::parse(NULL, changed_wire.data(), changed_wire.size(), &predicate);
+  CHECK(lazy && lazy->getMessage().datamessage().variables_size() == 2);
+  CHECK(calls == 7);
+
+  // The fast path and the protobuf fallback of the SchemaDecoder.
+  std::shared_ptr<VariableFilter> shared = std::make_shared<VariableFilter>();
+  shared->add(2, 1);
+  shared->add(2, 5);
+  SchemaDecoder decoder;
+  decoder.setFilter(shared);
+  IdSink fast;
+  CHECK(decoder.decode(wire.data(), wire.size(), hostByteOrder(), fast));
+  CHECK(fast.ids == std::vector<int>({ 1, 5 }));
+  // A dropped variable with an encoding the fast path can not decode does not reject the frame.
+  TCPMessage coded = msg;
+  coded.mutable_datamessage()->mutable_variables(0)->mutable_metadata()->set_encoding(VariableDescription_Encoding_PACKED);
+  std::string coded_wire = coded.SerializeAsString();
+  IdSink fast_coded;
+  CHECK(decoder.decode(coded_wire.data(), coded_wire.size(), hostByteOrder(), fast_coded));
+  CHECK(fast_coded.ids == std::vector<int>({ 1, 5 }));
+  IdSink fallback;
+  decoder.decode(msg, hostByteOrder(), fallback);
+  CHECK(fallback.ids == std::vector<int>({ 1, 5 }));
+  return checks::result("variable_filter_check");
+}
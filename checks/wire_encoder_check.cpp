@@ -0,0 +1,126 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+// Checks that the WireEncoder writes byte for byte what protobuf serializes for the same DataMessage, see the README
+// for how to build it.
+
+#include <string>
+#include <vector>
+#include "../wire_encoder.h"
+#include "check.h"
+
+using namespace tcp_io_device;
+
+static MsgData variable(int entity_id, int id, VariableDescription_DataType type, std::vector<uint64_t> dimensions,
+  const std::string& opcode, VariableDescription_Encoding encoding, double scale, double offset, size_t size, char fill) {
+  ProtoVariable var;
+  VariableDescription* description = var.mutable_metadata();
+  description->set_entityid(entity_id);
+  description->set_id(id);
+  description->set_datatype(type);
+  for (uint64_t dimension : dimensions) {
+    description->add_dimensions(dimension);
+  }
+  description->set_opcode_string_handle(opcode);
+  description->set_encoding(encoding);
+  description->set_scale(scale);
+  description->set_offset(offset);
+  var.set_data(std::string(size, fill));
+  return MsgData(&var);
+}
+
+int main() {
+  // Written directly: RAW variables, including negative and large IDs, empty data and default values. Converted:
+  // PACKED and FLOAT16 variables.
+  std::vector<MsgData> variables;
+  variables.push_back(variable(1, 2, VariableDescription_DataType_DOUBLE, { 4 }, "", VariableDescription_Encoding_RAW, 0, 0, 32, 1));
+  variables.push_back(variable(-5, 300, VariableDescription_DataType_INT64, { 2, 3, 100000 }, "move", VariableDescription_Encoding_RAW, 0, 0, 48, 2));
+  variables.push_back(variable(0, 0, VariableDescription_DataType_DOUBLE, {}, "", VariableDescription_Encoding_RAW, -0.0, 2.5, 0, 0));
+  variables.push_back(variable(7, 8, VariableDescription_DataType_DOUBLE, { 3 }, "x", VariableDescription_Encoding_PACKED, 0, 0, 24, 0));
+  variables.push_back(variable(7, 9, VariableDescription_DataType_FLOAT, { 4 }, "", VariableDescription_Encoding_FLOAT16, 0, 0, 16, 0));
+  variables.push_back(variable(7, 10, VariableDescription_DataType_STRING, { 5 }, "", VariableDescription_Encoding_RAW, 0, 0, 5, 'a'));
+
+  WireEncoder encoder;
+  for (uint64_t timestamp : { 0ull, 5ull, 1ull << 40 }) {
+    for (uint64_t time_span : { 0ull, 77ull }) {
+      for (size_t count = 0; count <= variables.size(); ++count) {
+        std::vector<MsgData> subset(variables.begin(), variables.begin() + count);
+        TCPMessage msg;
+        msg.set_messagetype(TCPMessage_Type_DATA);
+        msg.set_timestamp(timestamp);
+        msg.mutable_datamessage()->set_timespan(time_span);
+        for (MsgData& var : subset) {
+          var.toMutableProtoVariable(msg.mutable_datamessage()->add_variables());
+        }
+        std::string expected = msg.SerializeAsString();
+
+        // Appended after what is already in the buffer.
+        std::string encoded = "pre";
+        encoder.encode(subset, time_span, timestamp, encoded);
+        CHECK(encoded == "pre" + expected);
+
+        std::string frame;
+        encoder.encodeFrame(subset, time_span, timestamp, frame);
+        uint64_t length = 0;
+        for (int i = 7; i >= 0 && frame.size() >= 8; --i) {
+          length = (length << 8) | (uint8_t)frame[i];
+        }
+        CHECK(frame.size() >= 8 && length == expected.size() && frame.substr(8) == expected);
+      }
+    }
+  }
+  CHECK(encoder.getDirectVariables() > 0 && encoder.getFallbackVariables() > 0);
+  return checks::result("wire_encoder_check");
+}
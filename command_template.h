@@ -0,0 +1,201 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021-2025 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "wire_encoder.h"
+
+
+namespace tcp_io_device {
+
+  /**
+  * Pre-encoded DATA TCPMessage for one command of the SetupMessage. The invariant bytes (message type, the
+  * ProtoVariable with the serialized VariableDescription and the tag and length of the data) are written once, so
+  * encoding a command only appends them, the payload and the timestamp. The output is byte identical to the message
+  * encoded by WireEncoder for a RAW MsgData of the command.
+  */
+  class CommandTemplate {
+  public:
+    /**
+    * Creates the template of a command. The data is always sent RAW, the encoding of the description is ignored.
+    * \param description The description of the command from the SetupMessage.
+    */
+    CommandTemplate(const CommandDescription& description) : name_(description.name()), meta_data_(&description.description()) {
+      meta_data_.setEncoding(VariableDescription_Encoding_RAW);
+      description_field_.resize(WireEncoder::lengthDelimitedSize(WireEncoder::descriptionSize(meta_data_)));
+      uint8_t* pos = (uint8_t*)&description_field_[0];
+      pos = WireEncoder::writeLengthDelimited(1, WireEncoder::descriptionSize(meta_data_), pos);
+      WireEncoder::writeDescription(meta_data_, pos);
+      appendPrefix(meta_data_.getDataSize(), 0, prefix_);
+    }
+
+    /**
+    * Returns the name of the command.
+    */
+    const std::string& getName() const { return name_; }
+
+    /**
+    * Returns the MetaData of the command, with RAW encoding.
+    */
+    const MetaData& getMetaData() const { return meta_data_; }
+
+    /**
+    * Appends the serialized DATA TCPMessage of the command to out, ready for SafeQueue::enqueueEncoded. If the payload
+    * has the size of the MetaData and time_span is 0, only the pre-encoded prefix is copied before the payload.
+    * \param payload The values of the command in the host byte order, in the RAW layout.
+    * \param size The number of bytes of the payload.
+    * \param time_span The timeSpan of the DataMessage.
+    * \param timestamp The timestamp of the TCPMessage.
+    * \param out The buffer to append to.
+    */
+    void encode(const char* payload, size_t size, uint64_t time_span, uint64_t timestamp, std::string& out) const {
+      if (size == meta_data_.getDataSize() && time_span == 0) {
+        out.append(prefix_);
+      }
+      else {
+        appendPrefix(size, time_span, out);
+      }
+      out.append(payload, size);
+      // The timeSpan of the DataMessage and the timestamp of the TCPMessage follow the payload.
+      uint8_t suffix[22];
+      uint8_t* pos = WireEncoder::writeVarintField(2, time_span, suffix);
+      pos = WireEncoder::writeVarintField(6, timestamp, pos);
+      out.append((const char*)suffix, pos - suffix);
+    }
+
+  private:
+    /**
+    * Appends the bytes in front of the payload to out.
+    */
+    void appendPrefix(size_t size, uint64_t time_span, std::string& out) const {
+      size_t data_field_size = size != 0 ? WireEncoder::lengthDelimitedSize(size) : 0;
+      size_t variable_size = description_field_.size() + data_field_size;
+      size_t data_message_size = WireEncoder::lengthDelimitedSize(variable_size) + WireEncoder::varintFieldSize(time_span);
+      // Message type, DataMessage, ProtoVariable and data tags with their lengths, at most 4 * 11 bytes.
+      size_t begin = out.size();
+      out.resize(begin + description_field_.size() + 44);
+      uint8_t* pos = (uint8_t*)&out[begin];
+      pos = WireEncoder::writeVarintField(1, TCPMessage_Type_DATA, pos);
+      pos = WireEncoder::writeLengthDelimited(3, data_message_size, pos);
+      pos = WireEncoder::writeLengthDelimited(1, variable_size, pos);
+      memcpy(pos, description_field_.data(), description_field_.size());
+      pos += description_field_.size();
+      if (size != 0) {
+        pos = WireEncoder::writeLengthDelimited(2, size, pos);
+      }
+      out.resize(pos - (uint8_t*)out.data());
+    }
+
+    std::string name_;
+    MetaData meta_data_;
+    // The metaData field of the ProtoVariable.
+    std::string description_field_;
+    // The prefix for payloads of the size of the MetaData and timeSpan 0.
+    std::string prefix_;
+  };
+
+  /**
+  * The CommandTemplates of all commands of a SetupMessage, see TCPConnection::getCommandTemplates.
+  */
+  class CommandTemplateCache {
+  public:
+    /**
+    * Creates the templates of all command descriptions of the SetupMessage.
+    * \param setup The SetupMessage.
+    */
+    CommandTemplateCache(const SetupMessage& setup) : tables_(setup) {
+      templates_.reserve(setup.commanddescriptions_size());
+      std::vector<std::pair<std::string, int>> names;
+      by_slot_.assign(tables_.getSlotCount(), -1);
+      for (const CommandDescription& description : setup.commanddescriptions()) {
+        names.emplace_back(description.name(), (int)templates_.size());
+        by_slot_[tables_.getSlot(description.description().entityid(), description.description().id())] = (int)templates_.size();
+        templates_.emplace_back(description);
+      }
+      by_name_ = NameTable(names);
+    }
+
+    /**
+    * Returns the template of the command with the passed name, NULL if there is none.
+    */
+    const CommandTemplate* find(const std::string& name) const {
+      int index;
+      return by_name_.find(name, index) ? &templates_[index] : NULL;
+    }
+
+    /**
+    * Returns the template of the command with the passed entity and ID, NULL if there is none.
+    */
+    const CommandTemplate* find(int entity_id, int id) const {
+      int slot = tables_.getSlot(entity_id, id);
+      return slot >= 0 && by_slot_[slot] >= 0 ? &templates_[by_slot_[slot]] : NULL;
+    }
+
+    /**
+    * Returns the templates in the order of the SetupMessage.
+    */
+    const std::vector<CommandTemplate>& getTemplates() const { return templates_; }
+
+  private:
+    std::vector<CommandTemplate> templates_;
+    SetupTables tables_;
+    // Index into templates_ for every slot of tables_, -1 for slots without command.
+    std::vector<int> by_slot_;
+    // Command name -> index into templates_.
+    NameTable by_name_;
+  };
+}
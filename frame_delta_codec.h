@@ -0,0 +1,242 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021-2025 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+#pragma once
+
+#include <unordered_map>
+#include "utils.h"
+
+namespace tcp_io_device {
+
+  /**
+  * Stateful codec sending only the changed byte ranges of large variables, used by the TCPConnection once it is
+  * negotiated in the StartMessage. For every (entityID, ID) the sender keeps the last sent value as reference:
+  * - DELTA_KEYFRAME: The full value is sent and becomes the new reference. Sent for the first frame, after
+  *   keyframe_interval deltas, if the size changed, or if more than half of the bytes changed.
+  * - DELTA_RANGES: The data field holds the changed bytes only, deltaRanges holds (gap, length) pairs, where gap is the
+  *   distance from the end of the previous range (or from 0).
+  * The receiver applies the ranges to its copy of the reference and hands out RAW data again. The state is reset
+  * whenever the connection is re-established.
+  */
+  class FrameDeltaCodec {
+  public:
+    /**
+    * Sets the sender parameters.
+    * \param keyframe_interval The maximum number of delta frames between two keyframes.
+    * \param min_size Variables with less bytes of data are not delta coded.
+    */
+    void configure(uint32_t keyframe_interval, uint64_t min_size) {
+      keyframe_interval_ = keyframe_interval;
+      min_size_ = min_size;
+    }
+
+    /**
+    * Forgets the references of all variables.
+    */
+    void reset() { references_.clear(); }
+
+    /**
+    * Delta codes all RAW variables of at least min_size bytes of the DataMessage in place.
+    */
+    void encode(DataMessage* msg) {
+      for (int i = 0; i < msg->variables_size(); ++i) {
+        encode(msg->mutable_variables(i));
+      }
+    }
+
+    /**
+    * Reconstructs all DELTA_KEYFRAME and DELTA_RANGES variables of the DataMessage in place to RAW.
+    */
+    void decode(DataMessage* msg) {
+      for (int i = 0; i < msg->variables_size(); ++i) {
+        decode(msg->mutable_variables(i));
+      }
+    }
+
+    void encode(ProtoVariable* var) {
+      const VariableDescription& description = var->metadata();
+      if (description.encoding() != VariableDescription_Encoding_RAW || var->data().size() < min_size_ ||
+        description.datatype() == VariableDescription_DataType_STRING) {
+        return;
+      }
+      Reference& reference = references_[key(description)];
+      const std::string& data = var->data();
+      if (reference.data.size() != data.size() || reference.frames_since_keyframe >= keyframe_interval_) {
+        sendKeyframe(var, reference);
+        return;
+      }
+
+      // Collect the changed blocks, merging ranges separated by less than a block.
+      std::vector<std::pair<size_t, size_t>> ranges;
+      size_t changed = 0;
+      for (size_t pos = 0; pos < data.size(); pos += block_size_) {
+        size_t length = std::min(block_size_, data.size() - pos);
+        if (memcmp(&data[pos], &reference.data[pos], length) == 0) {
+          continue;
+        }
+        if (!ranges.empty() && ranges.back().first + ranges.back().second + block_size_ >= pos) {
+          changed += pos + length - (ranges.back().first + ranges.back().second);
+          ranges.back().second = pos + length - ranges.back().first;
+        }
+        else {
+          ranges.push_back({ pos, length });
+          changed += length;
+        }
+      }
+      if (changed * 2 > data.size()) {
+        sendKeyframe(var, reference);
+        return;
+      }
+
+      std::string out;
+      out.reserve(changed);
+      google::protobuf::RepeatedField<uint64_t>* delta_ranges = var->mutable_deltaranges();
+      delta_ranges->Reserve((int)ranges.size() * 2);
+      size_t end = 0;
+      for (auto& range : ranges) {
+        out.append(data, range.first, range.second);
+        memcpy(&reference.data[range.first], &data[range.first], range.second);
+        delta_ranges->AddAlreadyReserved(range.first - end);
+        delta_ranges->AddAlreadyReserved(range.second);
+        end = range.first + range.second;
+      }
+      ++reference.frames_since_keyframe;
+      var->set_data(out);
+      var->mutable_metadata()->set_encoding(VariableDescription_Encoding_DELTA_RANGES);
+    }
+
+    void decode(ProtoVariable* var) {
+      const VariableDescription& description = var->metadata();
+      if (description.encoding() == VariableDescription_Encoding_DELTA_KEYFRAME) {
+        references_[key(description)].data = var->data();
+        var->mutable_metadata()->set_encoding(VariableDescription_Encoding_RAW);
+        return;
+      }
+      if (description.encoding() != VariableDescription_Encoding_DELTA_RANGES) {
+        return;
+      }
+      var->mutable_metadata()->set_encoding(VariableDescription_Encoding_RAW);
+      auto it = references_.find(key(description));
+      if (it == references_.end() || !applyRanges(*var, it->second.data)) {
+        std::cout << "WARNING: Cannot reconstruct delta frame of entity " << description.entityid() << " id " << description.id() << std::endl;
+        // Following delta frames are dropped as well until the next keyframe, instead of being applied to wrong bytes.
+        if (it != references_.end()) {
+          references_.erase(it);
+        }
+        var->clear_data();
+        var->clear_deltaranges();
+        return;
+      }
+      var->set_data(it->second.data);
+      var->clear_deltaranges();
+    }
+
+  private:
+    struct Reference {
+      std::string data;
+      uint32_t frames_since_keyframe = 0;
+    };
+
+    static uint64_t key(const VariableDescription& description) {
+      return ((uint64_t)(uint32_t)description.entityid() << 32) | (uint32_t)description.id();
+    }
+
+    static void sendKeyframe(ProtoVariable* var, Reference& reference) {
+      reference.data = var->data();
+      reference.frames_since_keyframe = 0;
+      var->mutable_metadata()->set_encoding(VariableDescription_Encoding_DELTA_KEYFRAME);
+    }
+
+    /**
+    * Applies the changed ranges of var to the reference. All ranges are checked before the first byte is written, so
+    * the reference is left untouched if any of them is invalid.
+    * \return false if the ranges do not fit the reference or do not add up to the changed bytes.
+    */
+    static bool applyRanges(const ProtoVariable& var, std::string& reference) {
+      const std::string& changed = var.data();
+      size_t pos = 0;
+      size_t end = 0;
+      for (int i = 0; i + 1 < var.deltaranges_size(); i += 2) {
+        uint64_t offset = end + var.deltaranges(i);
+        uint64_t length = var.deltaranges(i + 1);
+        // Compared by subtraction, so hostile ranges can not wrap the sums around.
+        if (offset < end || offset > reference.size() || length > reference.size() - offset || length > changed.size() - pos) {
+          return false;
+        }
+        pos += length;
+        end = offset + length;
+      }
+      if (pos != changed.size()) {
+        return false;
+      }
+      pos = 0;
+      end = 0;
+      for (int i = 0; i + 1 < var.deltaranges_size(); i += 2) {
+        uint64_t offset = end + var.deltaranges(i);
+        uint64_t length = var.deltaranges(i + 1);
+        memcpy(&reference[offset], &changed[pos], length);
+        pos += length;
+        end = offset + length;
+      }
+      return true;
+    }
+
+    std::unordered_map<uint64_t, Reference> references_;
+    uint32_t keyframe_interval_ = 30;
+    uint64_t min_size_ = 1024;
+    size_t block_size_ = 64;
+  };
+
+} // namespace tcp_io_device
@@ -0,0 +1,164 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021-2025 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+
+namespace tcp_io_device {
+
+  /**
+  * Flags of a frame. Sent in the most significant byte of the legacy 8 byte length prefix, or in the flags field of
+  * the FrameHeader.
+  */
+  typedef enum {
+    // The payload is compressed with LZ4 and starts with the uncompressed size (8 bytes, little endian).
+    FRAME_LZ4 = 0x01,
+    // The payload is compressed with zstd and starts with the uncompressed size (8 bytes, little endian).
+    FRAME_ZSTD = 0x02,
+    // The DataMessage may contain variables coded by the TimeSeriesCodec.
+    FRAME_TIME_SERIES = 0x04,
+    // The DataMessage may contain variables coded by the FrameDeltaCodec.
+    FRAME_DELTA = 0x08,
+  }FrameFlag;
+
+  /**
+  * Fixed size header sent in front of every frame once negotiated in the StartMessage. It replaces the legacy 8 byte
+  * length prefix and lets the receiver route or discard a frame without parsing the TCPMessage. All fields are little
+  * endian:
+  *   offset  0: magic     (4 bytes, "AERA")
+  *   offset  4: version   (1 byte)
+  *   offset  5: type      (1 byte, TCPMessage_Type)
+  *   offset  6: flags     (1 byte, FrameFlag)
+  *   offset  7: reserved  (1 byte, 0)
+  *   offset  8: length    (8 bytes, length of the payload following the header)
+  *   offset 16: sequence  (8 bytes, counts the frames sent, continued across reconnects)
+  *   offset 24: timestamp (8 bytes, send time in nanoseconds since the epoch)
+  * A legacy length prefix can not start with the magic and version, as it would announce a frame of more than 4 GB.
+  * The receiver therefore detects the header on every frame and accepts both.
+  */
+  struct FrameHeader {
+    static constexpr size_t SIZE = 32;
+    static constexpr uint32_t MAGIC = 0x41524541; // "AERA" read as little endian uint32_t.
+    static constexpr uint8_t VERSION = 1;
+
+    uint8_t version = VERSION;
+    uint8_t type = 0;
+    uint8_t flags = 0;
+    uint64_t length = 0;
+    uint64_t sequence = 0;
+    uint64_t timestamp = 0;
+
+    /**
+    * Checks if the first 8 bytes of a frame start a FrameHeader.
+    * \param buf At least 8 bytes.
+    * \return true if the magic and a supported version are found.
+    */
+    static bool detect(const char* buf) {
+      return load(buf, 4) == MAGIC && (uint8_t)buf[4] == VERSION;
+    }
+
+    /**
+    * Appends the header to a byte-stream.
+    * \param out The byte-stream.
+    */
+    void write(std::string& out) const {
+      store(out, MAGIC, 4);
+      out += (char)version;
+      out += (char)type;
+      out += (char)flags;
+      out += (char)0;
+      store(out, length, 8);
+      store(out, sequence, 8);
+      store(out, timestamp, 8);
+    }
+
+    /**
+    * Reads a header from a byte-stream.
+    * \param buf SIZE bytes.
+    * \return false if the magic or the version does not match.
+    */
+    bool read(const char* buf) {
+      if (!detect(buf)) {
+        return false;
+      }
+      version = (uint8_t)buf[4];
+      type = (uint8_t)buf[5];
+      flags = (uint8_t)buf[6];
+      length = load(buf + 8, 8);
+      sequence = load(buf + 16, 8);
+      timestamp = load(buf + 24, 8);
+      return true;
+    }
+
+  private:
+    static void store(std::string& out, uint64_t value, int bytes) {
+      for (int i = 0; i < bytes; ++i) {
+        out += (char)((value >> (i * 8)) & 0xFF);
+      }
+    }
+
+    static uint64_t load(const char* buf, int bytes) {
+      uint64_t value = 0;
+      for (int i = bytes - 1; i >= 0; --i) {
+        value <<= 8;
+        value |= (unsigned char)buf[i];
+      }
+      return value;
+    }
+  };
+
+} // namespace tcp_io_device
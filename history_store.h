@@ -0,0 +1,392 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021-2025 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <cmath>
+#include "schema_decoder.h"
+
+
+namespace tcp_io_device {
+
+  /**
+  * Minimum, maximum and mean of the values of one element of a variable over a window of its history.
+  */
+  struct WindowStats {
+    size_t count = 0;
+    double min = 0;
+    double max = 0;
+    double mean = 0;
+  };
+
+  /**
+  * The history of one variable: a ring of the last capacity samples, stored column-wise (all samples of element 0,
+  * then all samples of element 1, ...), so every element is a contiguous array of at most two segments.
+  */
+  struct HistoryRing {
+    HistoryRing(VariableDescription_DataType type, size_t elements, size_t capacity)
+      : type(type), type_size(typeSize(type)), elements(elements), capacity(capacity), timestamps(capacity), time_spans(capacity) {
+      values.resize(elements * capacity * type_size);
+    }
+
+    /**
+    * Returns the position in the ring of the sample with the passed index, 0 is the oldest sample.
+    */
+    size_t position(size_t index) const { return (head + capacity - count + index) % capacity; }
+
+    /**
+    * Returns the values of element at the passed position in the ring.
+    */
+    const char* value(size_t element, size_t position) const { return values.data() + (element * capacity + position) * type_size; }
+
+    std::mutex mutex;
+    const VariableDescription_DataType type;
+    const size_t type_size;
+    // Values per sample.
+    const size_t elements;
+    const size_t capacity;
+    std::vector<uint64_t> timestamps;
+    std::vector<uint64_t> time_spans;
+    AlignedBuffer values;
+    // Position of the next sample and number of samples.
+    size_t head = 0;
+    size_t count = 0;
+    // True while a sample is written at head and waits for the end of its DataMessage.
+    bool pending = false;
+  };
+
+  /**
+  * View of consecutive samples of one variable, pointing into its HistoryRing without copying. The ring is locked
+  * while the view exists, so keep views short-lived: the receiving thread waits to store new samples of the variable.
+  */
+  class HistoryView {
+  public:
+    HistoryView() {}
+
+    HistoryView(std::shared_ptr<HistoryRing> ring, std::unique_lock<std::mutex> lock, size_t first, size_t size)
+      : ring_(ring), lock_(std::move(lock)), first_(first), size_(size) {}
+
+    /**
+    * Returns the number of samples, 0 if the variable has no history.
+    */
+    size_t size() const { return size_; }
+
+    bool empty() const { return size_ == 0; }
+
+    /**
+    * Returns the number of values per sample.
+    */
+    size_t getElementCount() const { return ring_ ? ring_->elements : 0; }
+
+    /**
+    * Returns the data type of the values.
+    */
+    VariableDescription_DataType getType() const { return ring_ ? ring_->type : VariableDescription_DataType_BYTES; }
+
+    /**
+    * Returns the timestamp of the TCPMessage of the sample with index i, 0 is the oldest sample of the view.
+    */
+    uint64_t getTimestamp(size_t i) const { return ring_->timestamps[position(i)]; }
+
+    /**
+    * Returns the timeSpan of the DataMessage of the sample with index i.
+    */
+    uint64_t getTimeSpan(size_t i) const { return ring_->time_spans[position(i)]; }
+
+    /**
+    * Returns a value of the sample with index i. T must be the type of the values.
+    * \param i The index of the sample, 0 is the oldest sample of the view.
+    * \param element The index of the value in the sample.
+    */
+    template <typename T> T get(size_t i, size_t element = 0) const {
+      T value;
+      memcpy(&value, ring_->value(element, position(i)), sizeof(T));
+      return value;
+    }
+
+    /**
+    * Returns the values of one element of all samples as at most two contiguous arrays, oldest first.
+    * \param element The index of the value in the samples.
+    * \param first Set to the first array.
+    * \param first_count Set to the number of values of the first array.
+    * \param second Set to the second array, NULL if all values are in the first one.
+    * \param second_count Set to the number of values of the second array.
+    */
+    template <typename T> void getSegments(size_t element, const T*& first, size_t& first_count, const T*& second, size_t& second_count) const {
+      first = NULL;
+      second = NULL;
+      first_count = 0;
+      second_count = 0;
+      if (size_ == 0) {
+        return;
+      }
+      size_t begin = position(0);
+      first = (const T*)ring_->value(element, begin);
+      first_count = std::min(size_, ring_->capacity - begin);
+      if (first_count < size_) {
+        second = (const T*)ring_->value(element, 0);
+        second_count = size_ - first_count;
+      }
+    }
+
+  private:
+    size_t position(size_t i) const { return ring_->position(first_ + i); }
+
+    std::shared_ptr<HistoryRing> ring_;
+    std::unique_lock<std::mutex> lock_;
+    size_t first_ = 0;
+    size_t size_ = 0;
+  };
+
+  /**
+  * VariableSink keeping the history of every variable slot (see SetupTables): a ring of the last capacity samples,
+  * timestamped with the timestamp of the TCPMessage and the timeSpan of the DataMessage. Pass it to
+  * TCPConnection::setVariableSink, the rings are filled by the background thread and can be queried from any thread.
+  * A ring is created on the first sample of a variable and restarted if the data type or number of values changes.
+  * Window queries expect the timestamps of a variable to be non-decreasing.
+  */
+  class HistoryStore : public VariableSink {
+  public:
+    /**
+    * \param capacity The number of samples kept per variable.
+    */
+    HistoryStore(size_t capacity) : capacity_(std::max<size_t>(capacity, 1)) {}
+
+    /**
+    * Returns a view of the samples with begin_timestamp <= timestamp < end_timestamp.
+    * \param entity_id The entity ID of the variable.
+    * \param id The ID of the variable.
+    * \param begin_timestamp The first timestamp of the window.
+    * \param end_timestamp The end of the window (exclusive).
+    * \return The view, empty if the variable has no samples in the window.
+    */
+    HistoryView getWindow(int entity_id, int id, uint64_t begin_timestamp, uint64_t end_timestamp) const {
+      std::shared_ptr<HistoryRing> ring = findRing(entity_id, id);
+      if (!ring) {
+        return HistoryView();
+      }
+      std::unique_lock<std::mutex> lock(ring->mutex);
+      size_t first = lowerBound(*ring, begin_timestamp);
+      size_t end = std::max(first, lowerBound(*ring, end_timestamp));
+      return HistoryView(ring, std::move(lock), first, end - first);
+    }
+
+    /**
+    * Returns a view of the last n samples (less if the variable has less samples).
+    * \param entity_id The entity ID of the variable.
+    * \param id The ID of the variable.
+    * \param n The number of samples.
+    */
+    HistoryView getLast(int entity_id, int id, size_t n) const {
+      std::shared_ptr<HistoryRing> ring = findRing(entity_id, id);
+      if (!ring) {
+        return HistoryView();
+      }
+      std::unique_lock<std::mutex> lock(ring->mutex);
+      size_t size = std::min(n, ring->count);
+      size_t first = ring->count - size;
+      return HistoryView(ring, std::move(lock), first, size);
+    }
+
+    /**
+    * Computes the minimum, maximum and mean of one element over all samples of a view with SIMD kernels.
+    * \param view The samples.
+    * \param element The index of the value in the samples.
+    * \param stats Set to the result.
+    * \return false if the view is empty, the element does not exist or the values are not numeric (STRING, BYTES).
+    */
+    static bool getStats(const HistoryView& view, size_t element, WindowStats& stats) {
+      stats = WindowStats();
+      if (view.empty() || element >= view.getElementCount()) {
+        return false;
+      }
+      double min = INFINITY;
+      double max = -INFINITY;
+      double sum = 0;
+      bool numeric = visit(view.getType(), [&](auto traits) {
+        using T = typename decltype(traits)::type;
+        if constexpr (std::is_same<T, char>::value) {
+          return false;
+        }
+        else {
+          const T* first;
+          const T* second;
+          size_t first_count;
+          size_t second_count;
+          view.getSegments<T>(element, first, first_count, second, second_count);
+          kernels::minMaxSum(first, first_count, min, max, sum);
+          kernels::minMaxSum(second, second_count, min, max, sum);
+          return true;
+        }
+        });
+      if (!numeric) {
+        return false;
+      }
+      stats.count = view.size();
+      stats.min = min;
+      stats.max = max;
+      stats.mean = sum / view.size();
+      return true;
+    }
+
+    /**
+    * Computes the minimum, maximum and mean of one element over the samples with begin_timestamp <= timestamp < end_timestamp.
+    * \return false if there are no (numeric) samples in the window.
+    */
+    bool getWindowStats(int entity_id, int id, uint64_t begin_timestamp, uint64_t end_timestamp, WindowStats& stats, size_t element = 0) const {
+      return getStats(getWindow(entity_id, id, begin_timestamp, end_timestamp), element, stats);
+    }
+
+    /**
+    * Computes the minimum, maximum and mean of one element over the last n samples.
+    * \return false if there are no (numeric) samples.
+    */
+    bool getLastStats(int entity_id, int id, size_t n, WindowStats& stats, size_t element = 0) const {
+      return getStats(getLast(entity_id, id, n), element, stats);
+    }
+
+    /**
+    * Returns the number of variables not stored, because they were not part of the SetupMessage or their size is not
+    * a multiple of the size of their data type.
+    */
+    uint64_t getDroppedVariables() const { return dropped_variables_; }
+
+    void onSetup(std::shared_ptr<const SetupTables> tables) override {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tables_ = tables;
+      rings_.assign(tables->getSlotCount(), NULL);
+      pending_.clear();
+    }
+
+    void onVariable(const MetaData& meta_data, const char* data, size_t size) override {
+      int slot = tables_ ? tables_->getSlot(meta_data) : -1;
+      size_t type_size = typeSize(meta_data.getType());
+      if (slot < 0 || size == 0 || size % type_size != 0) {
+        dropped_variables_++;
+        return;
+      }
+      size_t elements = size / type_size;
+      // Only this thread replaces rings, so reading rings_ needs no lock here.
+      std::shared_ptr<HistoryRing> ring = rings_[slot];
+      if (!ring || ring->type != meta_data.getType() || ring->elements != elements) {
+        ring = std::make_shared<HistoryRing>(meta_data.getType(), elements, capacity_);
+        std::lock_guard<std::mutex> lock(mutex_);
+        rings_[slot] = ring;
+      }
+      std::lock_guard<std::mutex> lock(ring->mutex);
+      if (!ring->pending) {
+        // The sample written at head replaces the oldest one of a full ring.
+        if (ring->count == ring->capacity) {
+          ring->count--;
+        }
+        ring->pending = true;
+        pending_.push_back(ring);
+      }
+      for (size_t element = 0; element < elements; ++element) {
+        memcpy(ring->values.data() + (element * ring->capacity + ring->head) * type_size, data + element * type_size, type_size);
+      }
+    }
+
+    void onDataMessageEnd(uint64_t time_span, uint64_t timestamp) override {
+      for (const std::shared_ptr<HistoryRing>& ring : pending_) {
+        std::lock_guard<std::mutex> lock(ring->mutex);
+        ring->timestamps[ring->head] = timestamp;
+        ring->time_spans[ring->head] = time_span;
+        ring->head = (ring->head + 1) % ring->capacity;
+        ring->count++;
+        ring->pending = false;
+      }
+      pending_.clear();
+    }
+
+  private:
+    std::shared_ptr<HistoryRing> findRing(int entity_id, int id) const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      int slot = tables_ ? tables_->getSlot(entity_id, id) : -1;
+      return slot >= 0 ? rings_[slot] : NULL;
+    }
+
+    /**
+    * Returns the index of the first sample with a timestamp >= timestamp.
+    */
+    static size_t lowerBound(const HistoryRing& ring, uint64_t timestamp) {
+      size_t low = 0;
+      size_t high = ring.count;
+      while (low < high) {
+        size_t middle = (low + high) / 2;
+        if (ring.timestamps[ring.position(middle)] < timestamp) {
+          low = middle + 1;
+        }
+        else {
+          high = middle;
+        }
+      }
+      return low;
+    }
+
+    const size_t capacity_;
+    // Guards tables_ and rings_ against the readers, only the receiving thread writes them.
+    mutable std::mutex mutex_;
+    std::shared_ptr<const SetupTables> tables_;
+    std::vector<std::shared_ptr<HistoryRing>> rings_;
+    // The rings with a sample waiting for the end of its DataMessage, only used by the receiving thread.
+    std::vector<std::shared_ptr<HistoryRing>> pending_;
+    std::atomic<uint64_t> dropped_variables_{ 0 };
+  };
+}
@@ -0,0 +1,365 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021-2025 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+#pragma once
+
+#include <unordered_map>
+#include <google/protobuf/io/coded_stream.h>
+#include "utils.h"
+#include "variable_filter.h"
+
+namespace tcp_io_device {
+
+  /**
+  * A TCPMessage parsed from a received frame without copying the RAW payloads of its variables. The frame is kept
+  * alive (refcounted) by the LazyMessage and by every MsgData borrowing from it, and the data fields of RAW variables
+  * are left empty in the TCPMessage. Their payloads are exposed as views into the frame by getPayload(), and
+  * getMsgData() creates MsgData objects borrowing them. Variables with any other encoding are parsed as usual, so the
+  * codecs of the TCPConnection can still decode them.
+  */
+  class LazyMessage {
+  public:
+    /**
+    * Parses a serialized TCPMessage, leaving the RAW payloads in the frame.
+    * \param frame The frame, kept alive by the LazyMessage.
+    * \param data The serialized TCPMessage inside the frame.
+    * \param size The number of bytes of the serialized TCPMessage.
+    * \param filter If set, the variables it rejects are skipped, their payloads are never copied.
+    * \return The LazyMessage, NULL if the bytes are not a valid TCPMessage.
+    */
+    static std::unique_ptr<LazyMessage> parse(std::shared_ptr<const AlignedBuffer> frame, const char* data, size_t size,
+      VariableFilter* filter = NULL) {
+      std::unique_ptr<LazyMessage> lazy(new LazyMessage(std::move(frame)));
+      lazy->filter_ = filter;
+      bool ok = lazy->parseFields(data, size, lazy->message_.get(), [&](int field, const char* value, size_t length) {
+        switch (field) {
+        case 3:
+          return lazy->parseDataMessage(value, length, lazy->message_->mutable_datamessage());
+        case 7:
+          return lazy->parseFields(value, length, lazy->message_->mutable_batchmessage(), [&](int field, const char* value, size_t length) {
+            return field != 1 || lazy->parseDataMessage(value, length, lazy->message_->mutable_batchmessage()->add_datamessages());
+            });
+        default:
+          return false;
+        }
+        });
+      return ok ? std::move(lazy) : NULL;
+    }
+
+    /**
+    * Finds the RAW payload of the first variable with at least min_size bytes in the first bytes of a serialized
+    * TCPMessage. Used by the receiver to place a frame in memory so this payload is aligned for its data type, and
+    * can be borrowed by MsgData.
+    * \param data The first bytes of the serialized TCPMessage.
+    * \param size The number of bytes available, the payload may end beyond them.
+    * \param min_size The minimum size of the payload.
+    * \param offset Set to the offset of the payload from data.
+    * \param alignment Set to the alignment of the data type of the variable.
+    * \return true if such a payload starts within the bytes.
+    */
+    static bool locatePayload(const char* data, size_t size, size_t min_size, size_t& offset, size_t& alignment) {
+      return locatePayload(data, data, data + size, TCP_MESSAGE, min_size, offset, alignment);
+    }
+
+    TCPMessage& getMessage() { return *message_; }
+    const TCPMessage& getMessage() const { return *message_; }
+
+    /**
+    * Takes the TCPMessage out of the LazyMessage. Only useful for messages without borrowed payloads, e.g. SETUP.
+    */
+    std::unique_ptr<TCPMessage> releaseMessage() { return std::move(message_); }
+
+    /**
+    * Returns true if payloads of variables were left in the frame.
+    */
+    bool hasPayloads() const { return !payloads_.empty(); }
+
+    /**
+    * Returns the RAW payload of a variable of the message.
+    * \param var A variable of getMessage().
+    * \return The payload in the frame, valid as long as the LazyMessage is alive. The data field of var if it was
+    * not left in the frame.
+    */
+    std::string_view getPayload(const ProtoVariable* var) const {
+      auto it = payloads_.find(var);
+      return it == payloads_.end() ? std::string_view(var->data()) : it->second;
+    }
+
+    /**
+    * Creates the MsgData of a variable of the message, borrowing its payload from the frame where possible.
+    * \param var A variable of getMessage().
+    * \param byte_order The byte order of the sender, see TCPConnection::getPeerByteOrder().
+    */
+    MsgData getMsgData(const ProtoVariable* var, TCPMessage_ByteOrder byte_order = hostByteOrder()) const {
+      auto it = payloads_.find(var);
+      if (it == payloads_.end()) {
+        return MsgData(var, byte_order);
+      }
+      return MsgData(var, it->second, frame_, byte_order);
+    }
+
+    /**
+    * Copies the payloads left in the frame back into the data fields and returns the resulting TCPMessage.
+    */
+    std::unique_ptr<TCPMessage> materialize() {
+      for (auto& payload : payloads_) {
+        const_cast<ProtoVariable*>(payload.first)->set_data(payload.second.data(), payload.second.size());
+      }
+      payloads_.clear();
+      return std::move(message_);
+    }
+
+  private:
+    // The messages on the path from a TCPMessage to the payload of a variable.
+    typedef enum {
+      TCP_MESSAGE = 0,
+      BATCH_MESSAGE = 1,
+      DATA_MESSAGE = 2,
+      VARIABLE = 3,
+    }Level;
+
+    static bool locatePayload(const char* base, const char* pos, const char* end, Level level, size_t min_size, size_t& offset, size_t& alignment) {
+      VariableDescription description;
+      bool has_description = false;
+      while (pos < end) {
+        uint64_t tag;
+        uint64_t length = 0;
+        if (!readVarint(pos, end, tag)) {
+          return false;
+        }
+        int field = (int)(tag >> 3);
+        switch (tag & 7) {
+        case 0:
+          if (!readVarint(pos, end, length)) {
+            return false;
+          }
+          continue;
+        case 1:
+          length = 8;
+          break;
+        case 5:
+          length = 4;
+          break;
+        case 2:
+          if (!readVarint(pos, end, length)) {
+            return false;
+          }
+          break;
+        default:
+          return false;
+        }
+        const char* value = pos;
+        bool truncated = length > (uint64_t)(end - pos);
+        const char* value_end = truncated ? end : pos + length;
+        if ((tag & 7) == 2) {
+          Level nested = VARIABLE;
+          bool descend = true;
+          if (level == TCP_MESSAGE && field == 3) {
+            nested = DATA_MESSAGE;
+          }
+          else if (level == TCP_MESSAGE && field == 7) {
+            nested = BATCH_MESSAGE;
+          }
+          else if ((level == BATCH_MESSAGE || level == DATA_MESSAGE) && field == 1) {
+            nested = level == BATCH_MESSAGE ? DATA_MESSAGE : VARIABLE;
+          }
+          else {
+            descend = false;
+          }
+          if (descend && locatePayload(base, value, value_end, nested, min_size, offset, alignment)) {
+            return true;
+          }
+          if (level == VARIABLE && field == 1 && !truncated) {
+            has_description = description.ParseFromArray(value, (int)length);
+          }
+          // The meta data is serialized before the data, so the data type is known here.
+          if (level == VARIABLE && field == 2 && length >= min_size && has_description &&
+            description.encoding() == VariableDescription_Encoding_RAW) {
+            offset = value - base;
+            alignment = visit(description.datatype(), [](auto traits) { return decltype(traits)::alignment; });
+            return true;
+          }
+        }
+        if (truncated) {
+          return false;
+        }
+        pos = value_end;
+      }
+      return false;
+    }
+
+    LazyMessage(std::shared_ptr<const AlignedBuffer> frame) : message_(std::make_unique<TCPMessage>()), frame_(std::move(frame)) {}
+
+    /**
+    * Walks the fields of a serialized message. Length delimited fields are passed to nested first, all fields it does
+    * not consume are merged into msg in their original order.
+    * \param nested Called as nested(field, value, length), returns true if it consumed the field.
+    * \return false if the bytes are not a valid message.
+    */
+    template <typename F>
+    static bool parseFields(const char* data, size_t size, google::protobuf::MessageLite* msg, F&& nested) {
+      const char* pos = data;
+      const char* end = data + size;
+      // Start of the fields not consumed by nested, yet to be merged into msg.
+      const char* merge_from = data;
+      while (pos < end) {
+        const char* field_start = pos;
+        uint64_t tag;
+        if (!readVarint(pos, end, tag)) {
+          return false;
+        }
+        uint64_t length = 0;
+        switch (tag & 7) {
+        case 0:
+          if (!readVarint(pos, end, length)) {
+            return false;
+          }
+          continue;
+        case 1:
+          length = 8;
+          break;
+        case 5:
+          length = 4;
+          break;
+        case 2:
+          if (!readVarint(pos, end, length)) {
+            return false;
+          }
+          break;
+        default:
+          // Groups are not used by the protocol.
+          return false;
+        }
+        if (length > (uint64_t)(end - pos)) {
+          return false;
+        }
+        const char* value = pos;
+        pos += length;
+        if ((tag & 7) == 2 && nested((int)(tag >> 3), value, length)) {
+          if (!merge(msg, merge_from, field_start)) {
+            return false;
+          }
+          merge_from = pos;
+        }
+      }
+      return merge(msg, merge_from, end);
+    }
+
+    bool parseDataMessage(const char* data, size_t size, DataMessage* msg) {
+      return parseFields(data, size, msg, [&](int field, const char* value, size_t length) {
+        if (field != 1) {
+          return false;
+        }
+        // Consumed without adding a variable, so it is dropped.
+        if (filter_ && !filter_->acceptsVariable(value, length)) {
+          return true;
+        }
+        return parseVariable(value, length, msg->add_variables());
+        });
+    }
+
+    bool parseVariable(const char* data, size_t size, ProtoVariable* var) {
+      std::string_view payload;
+      bool has_payload = false;
+      bool ok = parseFields(data, size, var, [&](int field, const char* value, size_t length) {
+        if (field != 2) {
+          return false;
+        }
+        // The last occurence of a bytes field wins.
+        payload = std::string_view(value, length);
+        has_payload = true;
+        return true;
+        });
+      if (!ok || !has_payload) {
+        return ok;
+      }
+      if (var->metadata().encoding() == VariableDescription_Encoding_RAW) {
+        payloads_[var] = payload;
+      }
+      else {
+        // Coded payloads are decoded in place by the codecs, keep them in the message. This copies the full frame of a
+        // DELTA_KEYFRAME, which the frame delta codec copies into its reference anyway.
+        var->set_data(payload.data(), payload.size());
+      }
+      return true;
+    }
+
+    static bool merge(google::protobuf::MessageLite* msg, const char* begin, const char* end) {
+      if (begin == end) {
+        return true;
+      }
+      google::protobuf::io::CodedInputStream input((const uint8_t*)begin, (int)(end - begin));
+      return msg->MergePartialFromCodedStream(&input) && input.ConsumedEntireMessage();
+    }
+
+    static bool readVarint(const char*& pos, const char* end, uint64_t& value) {
+      value = 0;
+      for (int shift = 0; shift < 64 && pos < end; shift += 7) {
+        uint8_t byte = (uint8_t)*pos++;
+        value |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    std::unique_ptr<TCPMessage> message_;
+    std::shared_ptr<const AlignedBuffer> frame_;
+    std::unordered_map<const ProtoVariable*, std::string_view> payloads_;
+    VariableFilter* filter_ = NULL;
+  };
+
+} // namespace tcp_io_device
@@ -0,0 +1,419 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021-2025 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+#pragma once
+
+#include <unordered_map>
+#include "utils.h"
+#include "variable_filter.h"
+
+namespace tcp_io_device {
+
+  /**
+  * Receives the variables of DataMessages decoded by the SchemaDecoder, see TCPConnection::setVariableSink. Called by
+  * the background thread of the TCPConnection.
+  */
+  class VariableSink {
+  public:
+    virtual ~VariableSink() {}
+
+    /**
+    * Called for every variable of a received DataMessage, in the order of the message.
+    * \param meta_data The MetaData of the variable.
+    * \param data The values in the host byte order, in the RAW layout. Only valid during the call.
+    * \param size The number of bytes of the values.
+    */
+    virtual void onVariable(const MetaData& meta_data, const char* data, size_t size) = 0;
+
+    /**
+    * Called after the last variable of a received DataMessage.
+    * \param time_span The timeSpan of the DataMessage.
+    * \param timestamp The timestamp of the TCPMessage carrying the DataMessage.
+    */
+    virtual void onDataMessageEnd(uint64_t /*time_span*/, uint64_t /*timestamp*/) {}
+
+    /**
+    * Called when a SetupMessage is received, before the variables of the following DataMessages.
+    * \param tables The lookup tables of the SetupMessage.
+    */
+    virtual void onSetup(std::shared_ptr<const SetupTables> /*tables*/) {}
+  };
+
+  /**
+  * Decoder specialized on the variables seen so far. It walks the wire format of DATA and BATCH messages directly and
+  * hands the payloads to a VariableSink, without building TCPMessage, ProtoVariable or VariableDescription objects.
+  * The serialized VariableDescription of every variable is interned on first sight, together with its MetaData. On
+  * later frames it is only compared bytewise, and the payload length is validated against the interned MetaData.
+  * Anything unexpected (other message types, other encodings, packed or sparse fields, unknown fields, length
+  * mismatches) rejects the whole frame before any variable is delivered, so the caller can fall back to protobuf.
+  */
+  class SchemaDecoder {
+  public:
+    /**
+    * Forgets all interned variables.
+    */
+    void reset() { entries_.clear(); }
+
+    /**
+    * Sets a filter, the variables it rejects are not delivered to the sink.
+    * \param filter The filter, NULL to deliver all variables.
+    */
+    void setFilter(std::shared_ptr<VariableFilter> filter) { filter_ = filter; }
+
+    /**
+    * Decodes a serialized TCPMessage with the fast path.
+    * \param data The serialized TCPMessage.
+    * \param size The number of bytes of the serialized TCPMessage.
+    * \param byte_order The byte order of the sender.
+    * \param sink The sink receiving the variables.
+    * \return true if the message was decoded, false if it was rejected and nothing was delivered to the sink.
+    */
+    bool decode(const char* data, size_t size, TCPMessage_ByteOrder byte_order, VariableSink& sink) {
+      pending_.clear();
+      message_ends_.clear();
+      batch_timestamps_.clear();
+      uint64_t timestamp = 0;
+      bool ok = walk(data, size, [&](int field, int wire_type, const char* value, uint64_t length) {
+        switch (field) {
+        case 1:
+          // messageType, only DATA and BATCH are decoded.
+          return wire_type == 0 && (length == TCPMessage_Type_DATA || length == TCPMessage_Type_BATCH);
+        case 3:
+          return wire_type == 2 && walkDataMessage(value, length);
+        case 6:
+          timestamp = length;
+          return wire_type == 0;
+        case 7:
+          return wire_type == 2 && walk(value, length, [&](int field, int wire_type, const char* value, uint64_t length) {
+            if (field == 2) {
+              return walkTimestamps(wire_type, value, length);
+            }
+            return field == 1 && wire_type == 2 && walkDataMessage(value, length);
+            });
+        default:
+          return false;
+        }
+        });
+      // A missing messageType means SETUP.
+      if (!ok || message_ends_.empty()) {
+        fallback_frames_++;
+        return false;
+      }
+
+      size_t next = 0;
+      for (size_t i = 0; i < message_ends_.size(); ++i) {
+        for (; next < message_ends_[i].first; ++next) {
+          deliver(pending_[next], byte_order, sink);
+        }
+        sink.onDataMessageEnd(message_ends_[i].second, i < batch_timestamps_.size() ? batch_timestamps_[i] : timestamp);
+      }
+      fast_frames_++;
+      return true;
+    }
+
+    /**
+    * Hands the variables of a DATA or BATCH message parsed by protobuf to the sink. Used for the rejected frames.
+    * \param msg The TCPMessage, after the codecs of the TCPConnection were undone.
+    * \param byte_order The byte order of the sender.
+    * \param sink The sink receiving the variables.
+    */
+    void decode(const TCPMessage& msg, TCPMessage_ByteOrder byte_order, VariableSink& sink) {
+      if (msg.messagetype() == TCPMessage_Type_DATA) {
+        decode(msg.datamessage(), msg.timestamp(), byte_order, sink);
+      }
+      else if (msg.messagetype() == TCPMessage_Type_BATCH) {
+        const BatchMessage& batch = msg.batchmessage();
+        for (int i = 0; i < batch.datamessages_size(); ++i) {
+          decode(batch.datamessages(i), i < batch.timestamps_size() ? batch.timestamps(i) : msg.timestamp(), byte_order, sink);
+        }
+      }
+    }
+
+    /**
+    * Returns the number of frames decoded with the fast path.
+    */
+    uint64_t getFastFrames() const { return fast_frames_; }
+
+    /**
+    * Returns the number of frames rejected by the fast path.
+    */
+    uint64_t getFallbackFrames() const { return fallback_frames_; }
+
+  private:
+    struct Entry {
+      std::string description;
+      MetaData meta_data;
+    };
+
+    struct Pending {
+      const Entry* entry;
+      const char* data;
+      size_t size;
+    };
+
+    void decode(const DataMessage& data_msg, uint64_t timestamp, TCPMessage_ByteOrder byte_order, VariableSink& sink) {
+      for (const ProtoVariable& var : data_msg.variables()) {
+        if (filter_ && !filter_->accepts(var.metadata())) {
+          continue;
+        }
+        MsgData msg_data(&var, byte_order);
+        MetaData meta_data = msg_data.getMetaData();
+        sink.onVariable(meta_data, msg_data.getDataPointer<char>(), msg_data.getDataSize());
+      }
+      sink.onDataMessageEnd(data_msg.timespan(), timestamp);
+    }
+
+    bool walkDataMessage(const char* data, uint64_t size) {
+      uint64_t time_span = 0;
+      bool ok = walk(data, size, [&](int field, int wire_type, const char* value, uint64_t length) {
+        if (field == 1 && wire_type == 2) {
+          return walkVariable(value, length);
+        }
+        if (field == 2 && wire_type == 0) {
+          time_span = length;
+          return true;
+        }
+        return false;
+        });
+      message_ends_.push_back({ pending_.size(), time_span });
+      return ok;
+    }
+
+    /**
+    * Reads the timestamps of a BatchMessage, packed or not.
+    */
+    bool walkTimestamps(int wire_type, const char* value, uint64_t length) {
+      if (wire_type == 0) {
+        batch_timestamps_.push_back(length);
+        return true;
+      }
+      if (wire_type != 2) {
+        return false;
+      }
+      const char* end = value + length;
+      while (value < end) {
+        uint64_t timestamp;
+        if (!readVarint(value, end, timestamp)) {
+          return false;
+        }
+        batch_timestamps_.push_back(timestamp);
+      }
+      return true;
+    }
+
+    bool walkVariable(const char* data, uint64_t size) {
+      const char* description = NULL;
+      uint64_t description_size = 0;
+      Pending pending = { NULL, NULL, 0 };
+      bool ok = walk(data, size, [&](int field, int wire_type, const char* value, uint64_t length) {
+        if (wire_type != 2 || (field != 1 && field != 2)) {
+          return false;
+        }
+        if (field == 1) {
+          description = value;
+          description_size = length;
+        }
+        else {
+          pending.data = value;
+          pending.size = length;
+        }
+        return true;
+        });
+      if (ok && description && filter_ && !filter_->accepts(description, description_size)) {
+        // Skipped before interning, so rejected variables may also use other encodings.
+        return true;
+      }
+      if (!ok || !description || !(pending.entry = intern(description, description_size))) {
+        return false;
+      }
+      if (pending.size != pending.entry->meta_data.getDataSize()) {
+        return false;
+      }
+      pending_.push_back(pending);
+      return true;
+    }
+
+    /**
+    * Returns the entry of a serialized VariableDescription, interning it if it was not seen before.
+    * \return The entry, NULL if the variable can not be decoded with the fast path.
+    */
+    const Entry* intern(const char* description, uint64_t size) {
+      // Only the entityID (1) and ID (2) are read to find the entry, the rest is compared bytewise.
+      uint64_t entity_id = 0;
+      uint64_t id = 0;
+      walk(description, size, [&](int field, int wire_type, const char* /*value*/, uint64_t length) {
+        if (wire_type == 0 && field == 1) {
+          entity_id = length;
+        }
+        else if (wire_type == 0 && field == 2) {
+          id = length;
+        }
+        return true;
+        });
+      uint64_t key = ((uint64_t)(uint32_t)entity_id << 32) | (uint32_t)id;
+      auto it = entries_.find(key);
+      if (it != entries_.end() && it->second.description.size() == size &&
+        memcmp(it->second.description.data(), description, size) == 0) {
+        return &it->second;
+      }
+      if (it != entries_.end()) {
+        // The description changed, the entry may only be replaced if it is not used by the current frame.
+        for (const Pending& pending : pending_) {
+          if (pending.entry == &it->second) {
+            return NULL;
+          }
+        }
+      }
+      VariableDescription parsed;
+      if (!parsed.ParseFromArray(description, (int)size) || parsed.encoding() != VariableDescription_Encoding_RAW) {
+        return NULL;
+      }
+      Entry entry = { std::string(description, size), MetaData(&parsed) };
+      if (it != entries_.end()) {
+        it->second = entry;
+        return &it->second;
+      }
+      return &entries_.emplace(key, entry).first->second;
+    }
+
+    void deliver(const Pending& pending, TCPMessage_ByteOrder byte_order, VariableSink& sink) {
+      size_t width = pending.entry->meta_data.getTypeSize();
+      if (byte_order == hostByteOrder() || width <= 1 || pending.size == 0) {
+        sink.onVariable(pending.entry->meta_data, pending.data, pending.size);
+        return;
+      }
+      swap_buffer_.assign(pending.data, pending.size);
+      kernels::byteSwap(swap_buffer_.data(), pending.size / width, width);
+      sink.onVariable(pending.entry->meta_data, swap_buffer_.data(), pending.size);
+    }
+
+    /**
+    * Walks the fields of a serialized message, calling f(field, wire_type, value, length) for each. For varints the
+    * value is passed as length. Stops if f returns false.
+    * \return false if f returned false or the bytes are malformed.
+    */
+    template <typename F>
+    static bool walk(const char* data, uint64_t size, F&& f) {
+      const char* pos = data;
+      const char* end = data + size;
+      while (pos < end) {
+        uint64_t tag;
+        uint64_t length = 0;
+        if (!readVarint(pos, end, tag)) {
+          return false;
+        }
+        int wire_type = (int)(tag & 7);
+        const char* value = pos;
+        switch (wire_type) {
+        case 0:
+          if (!readVarint(pos, end, length)) {
+            return false;
+          }
+          if (!f((int)(tag >> 3), wire_type, NULL, length)) {
+            return false;
+          }
+          continue;
+        case 1:
+          length = 8;
+          break;
+        case 5:
+          length = 4;
+          break;
+        case 2:
+          if (!readVarint(pos, end, length)) {
+            return false;
+          }
+          value = pos;
+          break;
+        default:
+          return false;
+        }
+        if (length > (uint64_t)(end - pos)) {
+          return false;
+        }
+        pos += length;
+        if (!f((int)(tag >> 3), wire_type, value, length)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    static bool readVarint(const char*& pos, const char* end, uint64_t& value) {
+      value = 0;
+      for (int shift = 0; shift < 64 && pos < end; shift += 7) {
+        uint8_t byte = (uint8_t)*pos++;
+        value |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    std::unordered_map<uint64_t, Entry> entries_;
+    // Only delivered once the whole frame was accepted.
+    std::vector<Pending> pending_;
+    // (number of pending variables at the end of a DataMessage, its timeSpan)
+    std::vector<std::pair<size_t, uint64_t>> message_ends_;
+    // The timestamps of the DataMessages of a BatchMessage, empty for DATA messages and older senders.
+    std::vector<uint64_t> batch_timestamps_;
+    AlignedBuffer swap_buffer_;
+    std::shared_ptr<VariableFilter> filter_;
+    uint64_t fast_frames_ = 0;
+    uint64_t fallback_frames_ = 0;
+  };
+
+} // namespace tcp_io_device
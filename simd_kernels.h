@@ -0,0 +1,697 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021-2025 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__F16C__)
+#include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TCP_IO_DEVICE_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(__SSSE3__) || defined(__AVX2__)
+#define TCP_IO_DEVICE_SSSE3
+#include <tmmintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <stdlib.h>
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define TCP_IO_DEVICE_NEON
+#include <arm_neon.h>
+#endif
+
+namespace tcp_io_device {
+
+  /**
+  * Bulk conversion kernels used by MsgData to encode and decode the values of a variable. Every kernel has a scalar
+  * implementation and uses SSE2/AVX2 (or NEON) if the compiler targets it, so the results do not depend on the path taken.
+  */
+  namespace kernels {
+
+    /**
+    * Converts a single float to an IEEE 754 half precision float (round to nearest even).
+    */
+    inline uint16_t floatToHalf(float value) {
+      uint32_t f;
+      memcpy(&f, &value, sizeof(f));
+      uint32_t sign = (f >> 16) & 0x8000;
+      uint32_t abs = f & 0x7FFFFFFF;
+      if (abs >= 0x7F800000) {
+        // Inf or NaN, keep NaNs quiet.
+        return (uint16_t)(sign | 0x7C00 | (abs > 0x7F800000 ? 0x0200 : 0));
+      }
+      if (abs >= 0x477FF000) {
+        // Overflows to Inf after rounding.
+        return (uint16_t)(sign | 0x7C00);
+      }
+      if (abs < 0x38800000) {
+        // Subnormal half or zero.
+        if (abs < 0x33000000) {
+          return (uint16_t)sign;
+        }
+        uint32_t shift = 126 - (abs >> 23);
+        uint32_t mantissa = (abs & 0x007FFFFF) | 0x00800000;
+        uint32_t half = mantissa >> shift;
+        uint32_t rest = mantissa & ((1u << shift) - 1);
+        uint32_t halfway = 1u << (shift - 1);
+        if (rest > halfway || (rest == halfway && (half & 1))) {
+          ++half;
+        }
+        return (uint16_t)(sign | half);
+      }
+      uint32_t half = ((abs - 0x38000000) >> 13);
+      uint32_t rest = abs & 0x1FFF;
+      if (rest > 0x1000 || (rest == 0x1000 && (half & 1))) {
+        ++half;
+      }
+      return (uint16_t)(sign | half);
+    }
+
+    /**
+    * Converts a single IEEE 754 half precision float to a float.
+    */
+    inline float halfToFloat(uint16_t value) {
+      uint32_t sign = (uint32_t)(value & 0x8000) << 16;
+      uint32_t exponent = (value >> 10) & 0x1F;
+      uint32_t mantissa = value & 0x03FF;
+      uint32_t f;
+      if (exponent == 0x1F) {
+        f = sign | 0x7F800000 | (mantissa << 13);
+      }
+      else if (exponent != 0) {
+        f = sign | ((exponent + 112) << 23) | (mantissa << 13);
+      }
+      else if (mantissa == 0) {
+        f = sign;
+      }
+      else {
+        // Subnormal half, normalize it.
+        exponent = 113;
+        while (!(mantissa & 0x0400)) {
+          mantissa <<= 1;
+          --exponent;
+        }
+        f = sign | (exponent << 23) | ((mantissa & 0x03FF) << 13);
+      }
+      float result;
+      memcpy(&result, &f, sizeof(result));
+      return result;
+    }
+
+    inline void floatToHalf(const float* src, uint16_t* dst, size_t count) {
+      size_t i = 0;
+#if defined(__F16C__)
+      for (; i + 8 <= count; i += 8) {
+        __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128((__m128i*)(dst + i), h);
+      }
+#endif
+      for (; i < count; ++i) {
+        dst[i] = floatToHalf(src[i]);
+      }
+    }
+
+    inline void halfToFloat(const uint16_t* src, float* dst, size_t count) {
+      size_t i = 0;
+#if defined(__F16C__)
+      for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(src + i))));
+      }
+#endif
+      for (; i < count; ++i) {
+        dst[i] = halfToFloat(src[i]);
+      }
+    }
+
+    /**
+    * Converts floats to bfloat16 (the upper 16 bits of a float, round to nearest even). NaNs are not treated specially.
+    */
+    inline void floatToBFloat16(const float* src, uint16_t* dst, size_t count) {
+      size_t i = 0;
+#if defined(TCP_IO_DEVICE_SSE2)
+      const __m128i bias = _mm_set1_epi32(0x7FFF);
+      const __m128i one = _mm_set1_epi32(1);
+      for (; i + 8 <= count; i += 8) {
+        __m128i a = _mm_castps_si128(_mm_loadu_ps(src + i));
+        __m128i b = _mm_castps_si128(_mm_loadu_ps(src + i + 4));
+        a = _mm_add_epi32(a, _mm_add_epi32(bias, _mm_and_si128(_mm_srli_epi32(a, 16), one)));
+        b = _mm_add_epi32(b, _mm_add_epi32(bias, _mm_and_si128(_mm_srli_epi32(b, 16), one)));
+        // Arithmetic shift keeps the values in int16 range, so the signed saturating pack does not change them.
+        a = _mm_srai_epi32(a, 16);
+        b = _mm_srai_epi32(b, 16);
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packs_epi32(a, b));
+      }
+#endif
+      for (; i < count; ++i) {
+        uint32_t f;
+        memcpy(&f, &src[i], sizeof(f));
+        f += 0x7FFF + ((f >> 16) & 1);
+        dst[i] = (uint16_t)(f >> 16);
+      }
+    }
+
+    inline void bfloat16ToFloat(const uint16_t* src, float* dst, size_t count) {
+      size_t i = 0;
+#if defined(TCP_IO_DEVICE_SSE2)
+      const __m128i zero = _mm_setzero_si128();
+      for (; i + 8 <= count; i += 8) {
+        __m128i h = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_ps(dst + i, _mm_castsi128_ps(_mm_unpacklo_epi16(zero, h)));
+        _mm_storeu_ps(dst + i + 4, _mm_castsi128_ps(_mm_unpackhi_epi16(zero, h)));
+      }
+#endif
+      for (; i < count; ++i) {
+        uint32_t f = (uint32_t)src[i] << 16;
+        memcpy(&dst[i], &f, sizeof(f));
+      }
+    }
+
+#if defined(TCP_IO_DEVICE_SSE2)
+    /**
+    * Loads two values of src as doubles.
+    */
+    inline __m128d loadPairAsDouble(const double* src) { return _mm_loadu_pd(src); }
+    inline __m128d loadPairAsDouble(const float* src) { return _mm_cvtps_pd(_mm_castpd_ps(_mm_load_sd((const double*)src))); }
+#endif
+
+    /**
+    * Linear quantization to signed integers: q = round((value - offset) / scale), saturated to the range of Q. Computed
+    * in double precision, so DOUBLE values and large offsets keep their precision. NaN values are quantized to 0.
+    * \param src The values to quantize, either float or double.
+    * \param dst The quantized values, either int8_t or int16_t.
+    * \param count The number of values.
+    * \param scale The size of one quantization step.
+    * \param offset The value represented by q = 0.
+    */
+    template <typename S, typename Q>
+    inline void quantize(const S* src, Q* dst, size_t count, double scale, double offset) {
+      static_assert(std::is_same<S, float>::value || std::is_same<S, double>::value, "Only float and double are supported");
+      static_assert(std::is_same<Q, int8_t>::value || std::is_same<Q, int16_t>::value, "Only int8_t and int16_t are supported");
+      const double inv_scale = scale != 0 ? 1.0 / scale : 0.0;
+      const double q_min = (double)std::numeric_limits<Q>::min();
+      const double q_max = (double)std::numeric_limits<Q>::max();
+      size_t i = 0;
+#if defined(TCP_IO_DEVICE_SSE2)
+      const __m128d v_inv_scale = _mm_set1_pd(inv_scale);
+      const __m128d v_offset = _mm_set1_pd(offset);
+      const __m128d v_min = _mm_set1_pd(q_min);
+      const __m128d v_max = _mm_set1_pd(q_max);
+      for (; i + 16 <= count; i += 16) {
+        __m128i q[4];
+        for (int k = 0; k < 4; ++k) {
+          __m128i pair[2];
+          for (int h = 0; h < 2; ++h) {
+            __m128d v = _mm_mul_pd(_mm_sub_pd(loadPairAsDouble(src + i + 4 * k + 2 * h), v_offset), v_inv_scale);
+            // NaN -> 0, like the scalar path.
+            v = _mm_and_pd(v, _mm_cmpord_pd(v, v));
+            pair[h] = _mm_cvtpd_epi32(_mm_min_pd(_mm_max_pd(v, v_min), v_max));
+          }
+          q[k] = _mm_unpacklo_epi64(pair[0], pair[1]);
+        }
+        __m128i lo = _mm_packs_epi32(q[0], q[1]);
+        __m128i hi = _mm_packs_epi32(q[2], q[3]);
+        if (sizeof(Q) == 1) {
+          _mm_storeu_si128((__m128i*)(dst + i), _mm_packs_epi16(lo, hi));
+        }
+        else {
+          _mm_storeu_si128((__m128i*)(dst + i), lo);
+          _mm_storeu_si128((__m128i*)(dst + i + 8), hi);
+        }
+      }
+#endif
+      for (; i < count; ++i) {
+        double v = ((double)src[i] - offset) * inv_scale;
+        if (v != v) {
+          v = 0;
+        }
+        dst[i] = (Q)std::lrint(std::min(std::max(v, q_min), q_max));
+      }
+    }
+
+    /**
+    * Inverse of quantize: value = offset + q * scale, computed in double precision.
+    * \param dst The values, either float or double.
+    */
+    template <typename Q, typename D>
+    inline void dequantize(const Q* src, D* dst, size_t count, double scale, double offset) {
+      static_assert(std::is_same<Q, int8_t>::value || std::is_same<Q, int16_t>::value, "Only int8_t and int16_t are supported");
+      static_assert(std::is_same<D, float>::value || std::is_same<D, double>::value, "Only float and double are supported");
+      size_t i = 0;
+#if defined(TCP_IO_DEVICE_SSE2)
+      const __m128d v_scale = _mm_set1_pd(scale);
+      const __m128d v_offset = _mm_set1_pd(offset);
+      for (; i + 8 <= count; i += 8) {
+        __m128i q16;
+        if (sizeof(Q) == 1) {
+          __m128i q8 = _mm_loadl_epi64((const __m128i*)(src + i));
+          // Sign extend int8 -> int16 by unpacking into the upper byte and shifting back.
+          q16 = _mm_srai_epi16(_mm_unpacklo_epi8(q8, q8), 8);
+        }
+        else {
+          q16 = _mm_loadu_si128((const __m128i*)(src + i));
+        }
+        __m128i q32[2] = { _mm_srai_epi32(_mm_unpacklo_epi16(q16, q16), 16), _mm_srai_epi32(_mm_unpackhi_epi16(q16, q16), 16) };
+        for (int k = 0; k < 4; ++k) {
+          // Pairs 1 and 3 are the upper halves of q32[0] and q32[1].
+          __m128i q = (k & 1) ? _mm_unpackhi_epi64(q32[k / 2], q32[k / 2]) : q32[k / 2];
+          __m128d v = _mm_add_pd(_mm_mul_pd(_mm_cvtepi32_pd(q), v_scale), v_offset);
+          if constexpr (std::is_same<D, double>::value) {
+            _mm_storeu_pd(dst + i + 2 * k, v);
+          }
+          else {
+            _mm_store_sd((double*)(dst + i + 2 * k), _mm_castps_pd(_mm_cvtpd_ps(v)));
+          }
+        }
+      }
+#endif
+      for (; i < count; ++i) {
+        dst[i] = (D)((double)src[i] * scale + offset);
+      }
+    }
+
+    /**
+    * Converts count values from S to D with static_cast semantics. Specialised with SIMD for the conversions used by
+    * AERA (double and int32 to float, float to double), other pairs rely on the compiler to vectorize the loop.
+    */
+    template <typename S, typename D>
+    inline void convert(const S* src, D* dst, size_t count) {
+      for (size_t i = 0; i < count; ++i) {
+        dst[i] = static_cast<D>(src[i]);
+      }
+    }
+
+    template <>
+    inline void convert<double, float>(const double* src, float* dst, size_t count) {
+      size_t i = 0;
+#if defined(__AVX2__)
+      for (; i + 8 <= count; i += 8) {
+        __m128 lo = _mm256_cvtpd_ps(_mm256_loadu_pd(src + i));
+        __m128 hi = _mm256_cvtpd_ps(_mm256_loadu_pd(src + i + 4));
+        _mm256_storeu_ps(dst + i, _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1));
+      }
+#elif defined(TCP_IO_DEVICE_SSE2)
+      for (; i + 4 <= count; i += 4) {
+        __m128 lo = _mm_cvtpd_ps(_mm_loadu_pd(src + i));
+        __m128 hi = _mm_cvtpd_ps(_mm_loadu_pd(src + i + 2));
+        _mm_storeu_ps(dst + i, _mm_movelh_ps(lo, hi));
+      }
+#endif
+      for (; i < count; ++i) {
+        dst[i] = (float)src[i];
+      }
+    }
+
+    template <>
+    inline void convert<float, double>(const float* src, double* dst, size_t count) {
+      size_t i = 0;
+#if defined(__AVX2__)
+      for (; i + 4 <= count; i += 4) {
+        _mm256_storeu_pd(dst + i, _mm256_cvtps_pd(_mm_loadu_ps(src + i)));
+      }
+#elif defined(TCP_IO_DEVICE_SSE2)
+      for (; i + 4 <= count; i += 4) {
+        __m128 v = _mm_loadu_ps(src + i);
+        _mm_storeu_pd(dst + i, _mm_cvtps_pd(v));
+        _mm_storeu_pd(dst + i + 2, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+      }
+#endif
+      for (; i < count; ++i) {
+        dst[i] = (double)src[i];
+      }
+    }
+
+    template <>
+    inline void convert<int32_t, float>(const int32_t* src, float* dst, size_t count) {
+      size_t i = 0;
+#if defined(__AVX2__)
+      for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i*)(src + i))));
+      }
+#elif defined(TCP_IO_DEVICE_SSE2)
+      for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(dst + i, _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*)(src + i))));
+      }
+#endif
+      for (; i < count; ++i) {
+        dst[i] = (float)src[i];
+      }
+    }
+
+    template <>
+    inline void convert<int64_t, float>(const int64_t* src, float* dst, size_t count) {
+      // There is no packed int64 -> float instruction below AVX-512. Values within +-2^51 are converted exactly to double
+      // with the magic number trick and then narrowed, larger values take the scalar path.
+      size_t i = 0;
+#if defined(__AVX2__)
+      const __m256i magic_i = _mm256_castpd_si256(_mm256_set1_pd(6755399441055744.0)); // 2^52 + 2^51
+      const __m256d magic_d = _mm256_set1_pd(6755399441055744.0);
+      const __m256i limit = _mm256_set1_epi64x((int64_t)1 << 51);
+      const __m256i neg_limit = _mm256_set1_epi64x(-((int64_t)1 << 51));
+      for (; i + 4 <= count; i += 4) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i out_of_range = _mm256_or_si256(_mm256_cmpgt_epi64(v, limit), _mm256_cmpgt_epi64(neg_limit, v));
+        if (!_mm256_testz_si256(out_of_range, out_of_range)) {
+          for (size_t k = i; k < i + 4; ++k) {
+            dst[k] = (float)src[k];
+          }
+          continue;
+        }
+        __m256d d = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_add_epi64(v, magic_i)), magic_d);
+        _mm_storeu_ps(dst + i, _mm256_cvtpd_ps(d));
+      }
+#endif
+      for (; i < count; ++i) {
+        dst[i] = (float)src[i];
+      }
+    }
+
+    /**
+    * Folds the minimum, maximum and sum of count values into min, max and sum, so several segments can be combined
+    * (start with +infinity, -infinity and 0). The sum is accumulated in double in four interleaved lanes, combined as
+    * (lane 0 + lane 1) + (lane 2 + lane 3), on every path. NaN values are ignored by min and max.
+    */
+    template <typename T>
+    inline void minMaxSum(const T* src, size_t count, double& min, double& max, double& sum) {
+      double lanes[4] = { 0, 0, 0, 0 };
+      for (size_t i = 0; i < count; ++i) {
+        double value = (double)src[i];
+        min = value < min ? value : min;
+        max = max < value ? value : max;
+        lanes[i % 4] += value;
+      }
+      sum += (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+
+    /**
+    * SIMD part of minMaxSum for double values, adds to the four lanes of the scalar implementation. Returns the
+    * number of values handled, a multiple of 4.
+    */
+    inline size_t minMaxSumBlocks(const double* src, size_t count, double& min, double& max, double* lanes) {
+      size_t i = 0;
+#if defined(__AVX2__)
+      if (count >= 4) {
+        __m256d v_min = _mm256_set1_pd(min);
+        __m256d v_max = _mm256_set1_pd(max);
+        __m256d v_sum = _mm256_loadu_pd(lanes);
+        for (; i + 4 <= count; i += 4) {
+          __m256d v = _mm256_loadu_pd(src + i);
+          // The accumulator is the second operand, so NaN values are ignored like in the scalar loop.
+          v_min = _mm256_min_pd(v, v_min);
+          v_max = _mm256_max_pd(v, v_max);
+          v_sum = _mm256_add_pd(v_sum, v);
+        }
+        double m[4];
+        _mm256_storeu_pd(m, v_min);
+        min = std::min(std::min(m[0], m[1]), std::min(m[2], m[3]));
+        _mm256_storeu_pd(m, v_max);
+        max = std::max(std::max(m[0], m[1]), std::max(m[2], m[3]));
+        _mm256_storeu_pd(lanes, v_sum);
+      }
+#elif defined(TCP_IO_DEVICE_SSE2)
+      if (count >= 4) {
+        __m128d v_min = _mm_set1_pd(min);
+        __m128d v_max = _mm_set1_pd(max);
+        __m128d v_sum_lo = _mm_loadu_pd(lanes);
+        __m128d v_sum_hi = _mm_loadu_pd(lanes + 2);
+        for (; i + 4 <= count; i += 4) {
+          __m128d lo = _mm_loadu_pd(src + i);
+          __m128d hi = _mm_loadu_pd(src + i + 2);
+          v_min = _mm_min_pd(hi, _mm_min_pd(lo, v_min));
+          v_max = _mm_max_pd(hi, _mm_max_pd(lo, v_max));
+          v_sum_lo = _mm_add_pd(v_sum_lo, lo);
+          v_sum_hi = _mm_add_pd(v_sum_hi, hi);
+        }
+        double m[2];
+        _mm_storeu_pd(m, v_min);
+        min = std::min(m[0], m[1]);
+        _mm_storeu_pd(m, v_max);
+        max = std::max(m[0], m[1]);
+        _mm_storeu_pd(lanes, v_sum_lo);
+        _mm_storeu_pd(lanes + 2, v_sum_hi);
+      }
+#endif
+      return i;
+    }
+
+    template <>
+    inline void minMaxSum<double>(const double* src, size_t count, double& min, double& max, double& sum) {
+      double lanes[4] = { 0, 0, 0, 0 };
+      size_t i = minMaxSumBlocks(src, count, min, max, lanes);
+      for (; i < count; ++i) {
+        double value = src[i];
+        min = value < min ? value : min;
+        max = max < value ? value : max;
+        lanes[i % 4] += value;
+      }
+      sum += (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+
+    template <>
+    inline void minMaxSum<float>(const float* src, size_t count, double& min, double& max, double& sum) {
+      // Widened in blocks, so the double kernel can be used.
+      double lanes[4] = { 0, 0, 0, 0 };
+      double block[256];
+      for (size_t begin = 0; begin < count; begin += 256) {
+        size_t n = std::min<size_t>(256, count - begin);
+        convert(src + begin, block, n);
+        size_t i = minMaxSumBlocks(block, n, min, max, lanes);
+        for (; i < n; ++i) {
+          min = block[i] < min ? block[i] : min;
+          max = max < block[i] ? block[i] : max;
+          lanes[i % 4] += block[i];
+        }
+      }
+      sum += (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+
+    /**
+    * Packs count bools (one byte each, nonzero is true) into bits, least significant bit first. dst needs (count + 7) / 8 bytes.
+    */
+    inline void packBits(const uint8_t* src, uint8_t* dst, size_t count) {
+      size_t i = 0;
+#if defined(__AVX2__)
+      const __m256i zero256 = _mm256_setzero_si256();
+      for (; i + 32 <= count; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+        uint32_t bits = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, zero256));
+        memcpy(dst + i / 8, &bits, 4);
+      }
+#endif
+#if defined(TCP_IO_DEVICE_SSE2)
+      const __m128i zero = _mm_setzero_si128();
+      for (; i + 16 <= count; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        uint16_t bits = (uint16_t)~_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero));
+        dst[i / 8] = (uint8_t)bits;
+        dst[i / 8 + 1] = (uint8_t)(bits >> 8);
+      }
+#endif
+      for (; i < count; i += 8) {
+        uint8_t byte = 0;
+        for (size_t j = 0; j < 8 && i + j < count; ++j) {
+          byte |= (uint8_t)((src[i + j] != 0) << j);
+        }
+        dst[i / 8] = byte;
+      }
+    }
+
+    /**
+    * Unpacks count bits, least significant bit first, into bools of one byte each (0 or 1).
+    */
+    inline void unpackBits(const uint8_t* src, uint8_t* dst, size_t count) {
+      size_t i = 0;
+#if defined(TCP_IO_DEVICE_SSE2)
+      const __m128i bit_mask = _mm_set_epi8((char)128, 64, 32, 16, 8, 4, 2, 1, (char)128, 64, 32, 16, 8, 4, 2, 1);
+      const __m128i one = _mm_set1_epi8(1);
+      for (; i + 16 <= count; i += 16) {
+        // Broadcast the two source bytes to the low and high 8 lanes and test one bit per lane.
+        __m128i v = _mm_set_epi64x((int64_t)(0x0101010101010101ULL * src[i / 8 + 1]), (int64_t)(0x0101010101010101ULL * src[i / 8]));
+        __m128i set = _mm_cmpeq_epi8(_mm_and_si128(v, bit_mask), bit_mask);
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_and_si128(set, one));
+      }
+#endif
+      for (; i < count; ++i) {
+        dst[i] = (src[i / 8] >> (i % 8)) & 1;
+      }
+    }
+
+    /**
+    * Appends the indices of all values of width bytes that are not all-zero bytes to indices. Blocks of 16 zero bytes are
+    * skipped with a single SIMD compare, so mostly-zero data is scanned quickly.
+    * \param data The values.
+    * \param count The number of values.
+    * \param width The size of a single value in bytes.
+    * \param indices The vector to append the indices to.
+    */
+    inline void collectNonZero(const char* data, size_t count, size_t width, std::vector<uint64_t>& indices) {
+      size_t i = 0;
+#if defined(TCP_IO_DEVICE_SSE2)
+      if (16 % width == 0) {
+        const __m128i zero = _mm_setzero_si128();
+        size_t per_block = 16 / width;
+        for (; i + per_block <= count; i += per_block) {
+          __m128i v = _mm_loadu_si128((const __m128i*)(data + i * width));
+          if (_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)) == 0xFFFF) {
+            continue;
+          }
+          for (size_t k = i; k < i + per_block; ++k) {
+            for (size_t b = 0; b < width; ++b) {
+              if (data[k * width + b] != 0) {
+                indices.push_back(k);
+                break;
+              }
+            }
+          }
+        }
+      }
+#endif
+      for (; i < count; ++i) {
+        for (size_t b = 0; b < width; ++b) {
+          if (data[i * width + b] != 0) {
+            indices.push_back(i);
+            break;
+          }
+        }
+      }
+    }
+
+    inline uint16_t byteSwap16(uint16_t v) { return (uint16_t)((v >> 8) | (v << 8)); }
+
+    inline uint32_t byteSwap32(uint32_t v) {
+#if defined(_MSC_VER)
+      return _byteswap_ulong(v);
+#else
+      return __builtin_bswap32(v);
+#endif
+    }
+
+    inline uint64_t byteSwap64(uint64_t v) {
+#if defined(_MSC_VER)
+      return _byteswap_uint64(v);
+#else
+      return __builtin_bswap64(v);
+#endif
+    }
+
+    /**
+    * Reverses the byte order of count values of width bytes each, in place. Widths other than 2, 4 and 8 are left untouched.
+    * \param data The values, no alignment required.
+    * \param count The number of values.
+    * \param width The size of a single value in bytes.
+    */
+    inline void byteSwap(void* data, size_t count, size_t width) {
+      if (width != 2 && width != 4 && width != 8) {
+        return;
+      }
+      char* bytes = (char*)data;
+      size_t size = count * width;
+      size_t i = 0;
+#if defined(TCP_IO_DEVICE_SSSE3)
+      const __m128i mask16 = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+      const __m128i mask32 = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+      const __m128i mask64 = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+      const __m128i mask = width == 2 ? mask16 : (width == 4 ? mask32 : mask64);
+#if defined(__AVX2__)
+      const __m256i mask256 = _mm256_broadcastsi128_si256(mask);
+      for (; i + 32 <= size; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(bytes + i));
+        _mm256_storeu_si256((__m256i*)(bytes + i), _mm256_shuffle_epi8(v, mask256));
+      }
+#endif
+      for (; i + 16 <= size; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(bytes + i));
+        _mm_storeu_si128((__m128i*)(bytes + i), _mm_shuffle_epi8(v, mask));
+      }
+#elif defined(TCP_IO_DEVICE_NEON)
+      for (; i + 16 <= size; i += 16) {
+        uint8x16_t v = vld1q_u8((const uint8_t*)(bytes + i));
+        v = width == 2 ? vrev16q_u8(v) : (width == 4 ? vrev32q_u8(v) : vrev64q_u8(v));
+        vst1q_u8((uint8_t*)(bytes + i), v);
+      }
+#endif
+      for (; i < size; i += width) {
+        if (width == 2) {
+          uint16_t v;
+          memcpy(&v, bytes + i, 2);
+          v = byteSwap16(v);
+          memcpy(bytes + i, &v, 2);
+        }
+        else if (width == 4) {
+          uint32_t v;
+          memcpy(&v, bytes + i, 4);
+          v = byteSwap32(v);
+          memcpy(bytes + i, &v, 4);
+        }
+        else {
+          uint64_t v;
+          memcpy(&v, bytes + i, 8);
+          v = byteSwap64(v);
+          memcpy(bytes + i, &v, 8);
+        }
+      }
+    }
+
+  } // namespace kernels
+} // namespace tcp_io_device
@@ -0,0 +1,380 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021-2025 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "schema_decoder.h"
+
+
+namespace tcp_io_device {
+
+  /**
+  * Copy of the latest values of all variable slots (see SetupTables) taken by StateTable::snapshot. Owned and reused
+  * by one reader, reading it needs no synchronization.
+  */
+  class StateSnapshot {
+    friend class StateTable;
+
+  public:
+    /**
+    * Returns the tables the slots refer to, NULL if no SetupMessage was received yet.
+    */
+    const std::shared_ptr<const SetupTables>& getSetupTables() const { return tables_; }
+
+    /**
+    * Returns the number of slots.
+    */
+    size_t getSlotCount() const { return versions_.size(); }
+
+    /**
+    * Returns the number of values received for the slot since the SetupMessage, 0 if the slot has no value yet.
+    */
+    uint64_t getVersion(int slot) const { return versions_[slot]; }
+
+    /**
+    * Returns true if a value was received for the slot.
+    */
+    bool hasValue(int slot) const { return versions_[slot] != 0; }
+
+    /**
+    * Returns the values of the slot in the host byte order, in the RAW layout. Aligned to 8 bytes.
+    */
+    const char* getData(int slot) const { return values_.data() + (size_t)slot * slot_size_; }
+
+    /**
+    * Returns the values of the slot as T.
+    */
+    template <typename T> const T* getData(int slot) const { return (const T*)getData(slot); }
+
+    /**
+    * Returns the number of bytes of the values of the slot.
+    */
+    size_t getDataSize(int slot) const { return sizes_[slot]; }
+
+    /**
+    * Returns the data type of the last value of the slot.
+    */
+    VariableDescription_DataType getType(int slot) const { return (VariableDescription_DataType)types_[slot]; }
+
+    /**
+    * Returns the timestamp of the TCPMessage carrying the last value of the slot.
+    */
+    uint64_t getTimestamp(int slot) const { return timestamps_[slot]; }
+
+    /**
+    * Returns the timeSpan of the DataMessage carrying the last value of the slot.
+    */
+    uint64_t getTimeSpan(int slot) const { return time_spans_[slot]; }
+
+  private:
+    std::shared_ptr<const SetupTables> tables_;
+    size_t slot_size_ = 0;
+    std::vector<uint64_t> versions_;
+    std::vector<uint64_t> timestamps_;
+    std::vector<uint64_t> time_spans_;
+    std::vector<uint32_t> sizes_;
+    std::vector<int32_t> types_;
+    AlignedBuffer values_;
+  };
+
+  /**
+  * VariableSink keeping the latest value of every variable slot (see SetupTables) in structure-of-arrays form, for
+  * readers sampling the current world state. Pass it to TCPConnection::setVariableSink, the background thread is the
+  * only writer. The layout is created when the SetupMessage arrives: every slot holds up to slot_size bytes, larger
+  * variables and variables of entities or IDs not in the SetupMessage are not stored.
+  * The table is double buffered. The writer applies the variables of a DataMessage to the back buffer and publishes
+  * it as the new front buffer at the end of the DataMessage, so readers always see whole DataMessages. Each buffer
+  * carries a sequence counter (seqlock): a reader copying the front buffer only retries if the writer published
+  * twice during the copy, so readers are lock-free, not wait-free. The writer never waits for readers and nothing is
+  * allocated after the SetupMessage. The layout of a previous SetupMessage is freed by the writer once no reader that may still copy from it is left:
+  * readers register in one of two reader counts, the writer switches new readers to the other count after replacing
+  * the layout and frees it as soon as the old count drops to zero.
+  */
+  class StateTable : public VariableSink {
+  public:
+    /**
+    * \param slot_size The maximum number of bytes of a variable, rounded up to a multiple of 8.
+    */
+    StateTable(size_t slot_size = 64) : slot_size_((slot_size + 7) / 8 * 8) {}
+
+    ~StateTable() {
+      delete state_.load();
+    }
+
+    StateTable(const StateTable&) = delete;
+    StateTable& operator=(const StateTable&) = delete;
+
+    /**
+    * Copies the latest values into snapshot. Only reallocates the snapshot if the layout changed. Can be called by any
+    * number of reader threads with their own snapshots. Lock-free but not wait-free: the copy is retried while the
+    * writer keeps publishing twice during it, so a reader is only bounded by the rate of the DataMessages.
+    * \param snapshot The snapshot to fill, empty if no SetupMessage was received yet.
+    */
+    void snapshot(StateSnapshot& snapshot) const {
+      // Registered until the copy is done, so the writer does not free the layout being copied.
+      uint32_t parity;
+      while (true) {
+        parity = parity_.load();
+        readers_[parity].fetch_add(1);
+        if (parity_.load() == parity) {
+          break;
+        }
+        readers_[parity].fetch_sub(1);
+      }
+      copy(snapshot);
+      readers_[parity].fetch_sub(1);
+    }
+
+    /**
+    * Returns the number of variables not stored, because they were larger than the slot size or not part of the
+    * SetupMessage.
+    */
+    uint64_t getDroppedVariables() const { return dropped_variables_; }
+
+    /**
+    * Returns the number of replaced layouts not freed yet, because readers may still copy from them.
+    */
+    uint64_t getRetiredLayouts() const { return retired_layouts_; }
+
+    void onSetup(std::shared_ptr<const SetupTables> tables) override {
+      State* state = new State(tables, slot_size_);
+      State* previous = state_.exchange(state, std::memory_order_acq_rel);
+      if (previous) {
+        retired_.emplace_back(previous);
+        retired_layouts_++;
+      }
+      reclaim();
+    }
+
+    void onVariable(const MetaData& meta_data, const char* data, size_t size) override {
+      State* state = state_.load(std::memory_order_relaxed);
+      int slot = state ? state->tables->getSlot(meta_data) : -1;
+      if (slot < 0 || size > slot_size_) {
+        dropped_variables_++;
+        return;
+      }
+      Buffer& back = beginWrite(*state);
+      memcpy(back.values.data() + (size_t)slot * slot_size_, data, size);
+      back.sizes[slot] = (uint32_t)size;
+      back.types[slot] = meta_data.getType();
+      back.versions[slot]++;
+      if (!state->marked[slot]) {
+        state->marked[slot] = 1;
+        state->dirty.push_back(slot);
+      }
+    }
+
+    void onDataMessageEnd(uint64_t time_span, uint64_t timestamp) override {
+      if (!retired_.empty() || !draining_.empty()) {
+        reclaim();
+      }
+      State* state = state_.load(std::memory_order_relaxed);
+      if (!state || !state->writing) {
+        return;
+      }
+      int back_index = 1 - state->front.load(std::memory_order_relaxed);
+      Buffer& back = state->buffers[back_index];
+      for (int slot : state->dirty) {
+        back.timestamps[slot] = timestamp;
+        back.time_spans[slot] = time_span;
+        state->marked[slot] = 0;
+      }
+      back.sequence.store(back.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+      state->front.store(back_index, std::memory_order_release);
+      // The new back buffer misses the slots just written, they are copied before the next write.
+      state->published.swap(state->dirty);
+      state->dirty.clear();
+      state->writing = false;
+    }
+
+  private:
+    struct Buffer {
+      // Odd while the writer modifies the buffer.
+      std::atomic<uint64_t> sequence{ 0 };
+      std::vector<uint64_t> versions;
+      std::vector<uint64_t> timestamps;
+      std::vector<uint64_t> time_spans;
+      std::vector<uint32_t> sizes;
+      std::vector<int32_t> types;
+      AlignedBuffer values;
+
+      void resize(size_t slot_count, size_t slot_size) {
+        versions.assign(slot_count, 0);
+        timestamps.assign(slot_count, 0);
+        time_spans.assign(slot_count, 0);
+        sizes.assign(slot_count, 0);
+        types.assign(slot_count, 0);
+        values.resize(slot_count * slot_size);
+      }
+
+      void copySlot(const Buffer& other, int slot, size_t slot_size) {
+        versions[slot] = other.versions[slot];
+        timestamps[slot] = other.timestamps[slot];
+        time_spans[slot] = other.time_spans[slot];
+        sizes[slot] = other.sizes[slot];
+        types[slot] = other.types[slot];
+        memcpy(values.data() + (size_t)slot * slot_size, other.values.data() + (size_t)slot * slot_size, slot_size);
+      }
+    };
+
+    /**
+    * The buffers of one SetupMessage.
+    */
+    struct State {
+      State(std::shared_ptr<const SetupTables> tables, size_t slot_size) : tables(tables) {
+        buffers[0].resize(tables->getSlotCount(), slot_size);
+        buffers[1].resize(tables->getSlotCount(), slot_size);
+        marked.assign(tables->getSlotCount(), 0);
+        dirty.reserve(tables->getSlotCount());
+        published.reserve(tables->getSlotCount());
+      }
+
+      std::shared_ptr<const SetupTables> tables;
+      Buffer buffers[2];
+      std::atomic<int> front{ 0 };
+      // Only used by the writer: the slots written to the back buffer and the slots of the last published buffer.
+      std::vector<int> dirty;
+      std::vector<int> published;
+      // Set for the slots in dirty.
+      std::vector<uint8_t> marked;
+      bool writing = false;
+    };
+
+    /**
+    * Copies the front buffer of the current layout into snapshot, retrying if the writer published in between.
+    */
+    void copy(StateSnapshot& snapshot) const {
+      while (true) {
+        State* state = state_.load(std::memory_order_acquire);
+        if (!state) {
+          snapshot = StateSnapshot();
+          return;
+        }
+        const Buffer& buffer = state->buffers[state->front.load(std::memory_order_acquire)];
+        uint64_t sequence = buffer.sequence.load(std::memory_order_acquire);
+        if (sequence & 1) {
+          continue;
+        }
+        if (snapshot.tables_ != state->tables) {
+          snapshot.tables_ = state->tables;
+        }
+        snapshot.slot_size_ = slot_size_;
+        snapshot.versions_.assign(buffer.versions.begin(), buffer.versions.end());
+        snapshot.timestamps_.assign(buffer.timestamps.begin(), buffer.timestamps.end());
+        snapshot.time_spans_.assign(buffer.time_spans.begin(), buffer.time_spans.end());
+        snapshot.sizes_.assign(buffer.sizes.begin(), buffer.sizes.end());
+        snapshot.types_.assign(buffer.types.begin(), buffer.types.end());
+        if (snapshot.values_.size() != buffer.values.size()) {
+          snapshot.values_.resize(buffer.values.size());
+        }
+        memcpy(snapshot.values_.data(), buffer.values.data(), buffer.values.size());
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (buffer.sequence.load(std::memory_order_relaxed) == sequence && state_.load(std::memory_order_relaxed) == state) {
+          return;
+        }
+      }
+    }
+
+    /**
+    * Frees the layouts no reader can copy from anymore. Called by the writer, never waits.
+    */
+    void reclaim() {
+      // The draining layouts were replaced before new readers were switched to the other count.
+      if (!draining_.empty() && readers_[1 - parity_.load()].load() == 0) {
+        retired_layouts_ -= draining_.size();
+        draining_.clear();
+      }
+      if (draining_.empty() && !retired_.empty()) {
+        draining_.swap(retired_);
+        parity_.store(1 - parity_.load());
+      }
+    }
+
+    /**
+    * Marks the back buffer as modified and brings it up to date with the front buffer on the first write of a
+    * DataMessage.
+    */
+    Buffer& beginWrite(State& state) {
+      int front_index = state.front.load(std::memory_order_relaxed);
+      Buffer& back = state.buffers[1 - front_index];
+      if (state.writing) {
+        return back;
+      }
+      back.sequence.store(back.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      for (int slot : state.published) {
+        back.copySlot(state.buffers[front_index], slot, slot_size_);
+      }
+      state.published.clear();
+      state.writing = true;
+      return back;
+    }
+
+    size_t slot_size_;
+    std::atomic<State*> state_{ nullptr };
+    // Layouts replaced by a later SetupMessage, only used by the writer. Retired layouts wait for the next switch of
+    // the reader count, draining ones for the readers of the old count to finish.
+    std::vector<std::unique_ptr<State>> retired_;
+    std::vector<std::unique_ptr<State>> draining_;
+    // Readers registered with each parity, new readers register with parity_.
+    mutable std::atomic<uint64_t> readers_[2] = { {0}, {0} };
+    std::atomic<uint32_t> parity_{ 0 };
+    std::atomic<uint64_t> retired_layouts_{ 0 };
+    std::atomic<uint64_t> dropped_variables_{ 0 };
+  };
+}
@@ -0,0 +1,282 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021-2025 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <unordered_map>
+#include "utils.h"
+
+
+namespace tcp_io_device {
+
+  /**
+  * Enforces the SubscriptionMessage of AERA on the DataMessages sent by the environment, so unwanted samples are not
+  * even serialized: variables without a Subscription are dropped (unless includeOthers is set), subscribed variables
+  * are decimated, rate limited by the DataMessage timestamps and, if changeOnly is set, only sent once they left the
+  * dead-band around the last sample sent. All variables pass until a subscription is set.
+  * Not thread safe, use it from the thread sending the DataMessages, or let the TCPConnection enforce the subscription it
+  * receives (see TCPConnection::setSubscriptionEnforced).
+  */
+  class SubscriptionFilter {
+  public:
+    /**
+    * Replaces the subscription, the sampling of all variables starts over.
+    * \param subscription The SubscriptionMessage received from AERA.
+    */
+    void setSubscription(const SubscriptionMessage& subscription) {
+      states_.clear();
+      for (const Subscription& s : subscription.subscriptions()) {
+        states_[key(s.entityid(), s.id())].subscription = s;
+      }
+      include_others_ = subscription.includeothers();
+      active_ = true;
+    }
+
+    /**
+    * Removes the subscription, all variables pass again.
+    */
+    void reset() {
+      states_.clear();
+      active_ = false;
+    }
+
+    /**
+    * Returns true if a subscription is set.
+    */
+    bool isActive() const { return active_; }
+
+    /**
+    * Decides if a sample of a variable is sent and updates the sampling state of the variable. Call it once per sample.
+    * \param meta_data The MetaData of the variable.
+    * \param data The values in the host byte order, in the RAW layout.
+    * \param size The number of bytes of the values.
+    * \param timestamp The timestamp of the DataMessage carrying the sample.
+    * \return true if the sample is sent.
+    */
+    bool accepts(const MetaData& meta_data, const char* data, size_t size, uint64_t timestamp) {
+      return decide(meta_data.getEntityID(), meta_data.getID(), timestamp, [&](auto changed) {
+        return changed(meta_data.getType(), data, size);
+        });
+    }
+
+    /**
+    * Removes the samples that are not sent, e.g. from the variables passed to WireEncoder::encode.
+    * \param variables The variables of a DataMessage.
+    * \param timestamp The timestamp of the DataMessage.
+    * \return The number of variables left.
+    */
+    size_t select(std::vector<MsgData>& variables, uint64_t timestamp) {
+      if (!active_) {
+        return variables.size();
+      }
+      auto end = std::remove_if(variables.begin(), variables.end(), [&](const MsgData& var) {
+        const MetaData& meta_data = var.meta_data_;
+        return !decide(meta_data.getEntityID(), meta_data.getID(), timestamp, [&](auto changed) {
+          return changed(meta_data.getType(), var.getDataPointer<char>(), var.getDataSize());
+          });
+        });
+      variables.erase(end, variables.end());
+      return variables.size();
+    }
+
+    /**
+    * Removes the samples that are not sent from a DataMessage. The data of a variable is only decoded if it is compared
+    * against its dead-band.
+    * \param msg The DataMessage, its values in the host byte order.
+    * \param timestamp The timestamp of the TCPMessage carrying the DataMessage.
+    * \return The number of variables left.
+    */
+    int select(DataMessage* msg, uint64_t timestamp) {
+      if (!active_) {
+        return msg->variables_size();
+      }
+      auto* variables = msg->mutable_variables();
+      int kept = 0;
+      for (int i = 0; i < variables->size(); ++i) {
+        const ProtoVariable& var = variables->Get(i);
+        bool sent = decide(var.metadata().entityid(), var.metadata().id(), timestamp, [&](auto changed) {
+          MsgData msg_data(&var);
+          return changed(var.metadata().datatype(), msg_data.getDataPointer<char>(), msg_data.getDataSize());
+          });
+        if (sent) {
+          if (kept != i) {
+            variables->SwapElements(kept, i);
+          }
+          ++kept;
+        }
+      }
+      variables->DeleteSubrange(kept, variables->size() - kept);
+      return kept;
+    }
+
+    /**
+    * Returns the number of samples dropped so far.
+    */
+    uint64_t getDroppedVariables() const { return dropped_variables_; }
+
+  private:
+    struct State {
+      Subscription subscription;
+      // Number of samples seen, for the decimation.
+      uint64_t samples = 0;
+      bool sent = false;
+      uint64_t last_timestamp = 0;
+      // The values of the last sample sent, only kept for changeOnly variables.
+      std::string last_data;
+    };
+
+    static uint64_t key(int entity_id, int id) { return ((uint64_t)(uint32_t)entity_id << 32) | (uint32_t)id; }
+
+    /**
+    * Applies the Subscription of a variable to a sample.
+    * \param with_data Called as with_data(changed) only for changeOnly variables, passes the data of the sample to
+    * changed(type, data, size) and returns its result.
+    */
+    template <typename F>
+    bool decide(int entity_id, int id, uint64_t timestamp, F&& with_data) {
+      if (!active_) {
+        return true;
+      }
+      bool sent = include_others_;
+      auto it = states_.find(key(entity_id, id));
+      if (it != states_.end()) {
+        State& state = it->second;
+        sent = isDue(state, timestamp);
+        if (sent && state.subscription.changeonly()) {
+          sent = with_data([&](VariableDescription_DataType type, const char* data, size_t size) {
+            if (!hasChanged(state, type, data, size, timestamp)) {
+              return false;
+            }
+            state.last_data.assign(data, size);
+            return true;
+            });
+        }
+        if (sent) {
+          state.sent = true;
+          state.last_timestamp = timestamp;
+        }
+      }
+      if (!sent) {
+        dropped_variables_++;
+      }
+      return sent;
+    }
+
+    /**
+    * Applies the decimation and the minimum interval, counting the sample.
+    */
+    static bool isDue(State& state, uint64_t timestamp) {
+      uint32_t decimation = state.subscription.decimation();
+      bool due = decimation <= 1 || state.samples % decimation == 0;
+      state.samples++;
+      uint64_t min_interval = state.subscription.mininterval();
+      return due && (!state.sent || min_interval == 0 || timestamp < state.last_timestamp ||
+        timestamp - state.last_timestamp >= min_interval);
+    }
+
+    /**
+    * Returns true if a sample left the dead-band around the last sample sent, or maxInterval passed since then.
+    */
+    static bool hasChanged(const State& state, VariableDescription_DataType type, const char* data, size_t size, uint64_t timestamp) {
+      if (!state.sent || size != state.last_data.size()) {
+        return true;
+      }
+      uint64_t max_interval = state.subscription.maxinterval();
+      if (max_interval != 0 && (timestamp < state.last_timestamp || timestamp - state.last_timestamp >= max_interval)) {
+        return true;
+      }
+      const char* last = state.last_data.data();
+      double dead_band = state.subscription.deadband();
+      return visit(type, [&](auto traits) {
+        using T = typename decltype(traits)::type;
+        if constexpr (std::is_same<T, bool>::value || std::is_same<T, char>::value) {
+          return memcmp(data, last, size) != 0;
+        }
+        else {
+          for (size_t offset = 0; offset + sizeof(T) <= size; offset += sizeof(T)) {
+            if (memcmp(data + offset, last + offset, sizeof(T)) == 0) {
+              continue;
+            }
+            T value;
+            T last_value;
+            memcpy(&value, data + offset, sizeof(T));
+            memcpy(&last_value, last + offset, sizeof(T));
+            double difference;
+            if constexpr (std::is_integral<T>::value) {
+              // In the unsigned type, so the difference of large integers does not overflow.
+              using U = typename std::make_unsigned<T>::type;
+              difference = (double)(value > last_value ? (U)value - (U)last_value : (U)last_value - (U)value);
+            }
+            else {
+              difference = std::fabs((double)value - (double)last_value);
+            }
+            // NaN differences count as changed.
+            if (!(difference <= dead_band)) {
+              return true;
+            }
+          }
+          return false;
+        }
+        });
+    }
+
+    std::unordered_map<uint64_t, State> states_;
+    bool include_others_ = true;
+    bool active_ = false;
+    uint64_t dropped_variables_ = 0;
+  };
+}
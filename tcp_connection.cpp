@@ -69,6 +69,16 @@
 
 #include "tcp_connection.h"
 
+#include <climits>
+#include <google/protobuf/io/coded_stream.h>
+
+#ifdef ENABLE_LZ4
+#include <lz4.h>
+#endif
+#ifdef ENABLE_ZSTD
+#include <zstd.h>
+#endif
+
 /**
  * Check if sock is a valid socket. We need this utility function to handle
  * Windows and non-Windows error codes.
@@ -114,6 +124,32 @@ namespace tcp_io_device {
     outgoing_queue_ = send_queue;
     incoming_queue_ = receive_queue;
     msg_length_buf_size_ = msg_length_buf_size;
+    peer_byte_order_ = TCPMessage_ByteOrder_LITTLE;
+    time_series_codec_requested_ = false;
+    time_series_codec_enabled_ = false;
+    frame_delta_requested_ = false;
+    frame_delta_enabled_ = false;
+    compression_requested_ = StartMessage_Compression_NO_COMPRESSION;
+    compression_threshold_requested_ = 0;
+    peer_compressions_ = 0;
+    compression_ = StartMessage_Compression_NO_COMPRESSION;
+    compression_threshold_ = 0;
+    frame_header_requested_ = false;
+    frame_header_enabled_ = false;
+    lost_frames_ = 0;
+    send_sequence_ = 0;
+    receive_sequence_ = 0;
+    receive_sequence_valid_ = false;
+    varint_framing_requested_ = false;
+    varint_framing_ = false;
+    read_ahead_begin_ = 0;
+    read_ahead_end_ = 0;
+    batch_max_size_requested_ = 0;
+    batch_max_latency_us_requested_ = 0;
+    batch_max_size_ = 0;
+    batch_max_latency_us_ = 0;
+    unpack_batches_ = true;
+    subscription_enforced_ = false;
     state_ = NOT_STARTED;
     setSocketInvalid(tcp_socket_);
     setSocketInvalid(server_listen_socket_);
@@ -356,20 +392,73 @@ namespace tcp_io_device {
           continue;
         }
         std::cout << "INFO: Reconnect successfull." << std::endl;
+        // The peer starts with fresh codec state on the new connection.
+        outgoing_codec_.reset();
+        incoming_codec_.reset();
+        outgoing_frame_delta_.reset();
+        incoming_frame_delta_.reset();
+        schema_decoder_.reset();
+        // The peer subscribes again on the new connection.
+        subscription_filter_.reset();
+        {
+          std::lock_guard<std::mutex> lock(setup_mutex_);
+          subscription_ = NULL;
+        }
+        // Everything negotiated with the StartMessages is off until the next StartMessage negotiates it again.
+        time_series_codec_enabled_ = false;
+        frame_delta_enabled_ = false;
+        compression_ = StartMessage_Compression_NO_COMPRESSION;
+        compression_threshold_ = 0;
+        frame_header_enabled_ = false;
+        // A batch collected before the connection was lost is sent right away, as the first frame on the new connection.
+        batch_max_size_ = 0;
+        batch_max_latency_us_ = 0;
+        varint_framing_ = false;
+        read_ahead_begin_ = 0;
+        read_ahead_end_ = 0;
         std::unique_ptr<TCPMessage> reconnect_msg = std::make_unique<TCPMessage>();
         reconnect_msg->set_messagetype(TCPMessage::RECONNECT);
         incoming_queue_->enqueue(std::move(reconnect_msg));
       }
       // First send all data from the queue
-      std::unique_ptr<TCPMessage> msg = outgoing_queue_->dequeue();
+      std::string encoded;
+      std::unique_ptr<TCPMessage> msg = outgoing_queue_->dequeue(encoded);
       while (msg) {
         std::cout << "Sending message of type " << msg->messagetype() << std::endl;
-        error_code = sendMessage(std::move(msg));
+        bool enforce_subscription = subscription_enforced_ && subscription_filter_.isActive();
+        // Pre-encoded messages are sent as they are, unless the codecs, batching or the subscription need the parsed message.
+        if (!encoded.empty() && (batch_max_size_ > 1 || frame_delta_enabled_ || time_series_codec_enabled_ || enforce_subscription)) {
+          msg->ParseFromString(encoded);
+          encoded.clear();
+        }
+        if (enforce_subscription && msg->messagetype() == TCPMessage_Type_DATA &&
+          subscription_filter_.select(msg->mutable_datamessage(), msg->timestamp()) == 0) {
+          // Nothing subscribed is left to send.
+          msg = std::move(outgoing_queue_->dequeue(encoded));
+          continue;
+        }
+        if (batch_max_size_ > 1 && msg->messagetype() == TCPMessage_Type_DATA) {
+          error_code = batchMessage(std::move(msg));
+        }
+        else {
+          // Keep the order, send the DataMessages waiting in the batch first.
+          error_code = flushBatch();
+          if (error_code > 0) {
+            error_code = encoded.empty() ? sendMessage(std::move(msg)) : sendFrame(TCPMessage_Type_DATA, 0, encoded);
+          }
+        }
         if (error_code <= 0) {
           // Error occured while sending message, break the loop and end the thread.
           break;
         }
-        msg = std::move(outgoing_queue_->dequeue());
+        msg = std::move(outgoing_queue_->dequeue(encoded));
+      }
+      // Send an incomplete batch once its first DataMessage waited long enough.
+      if (pending_batch_ && std::chrono::steady_clock::now() - pending_batch_start_ >= std::chrono::microseconds(batch_max_latency_us_)) {
+        error_code = flushBatch();
+        if (error_code <= 0) {
+          std::cout << "ERROR: Sending the pending batch failed" << std::endl;
+        }
       }
 
       // Yield to other threads while waiting for input.
@@ -377,7 +466,8 @@ namespace tcp_io_device {
       bool got_error = false;
       while (true) {
         // Check if new data is on the TCP connection to receive
-        int ready = receiveIsReady(tcp_socket_);
+        // Frames already in the read-ahead buffer are handled before polling the socket again.
+        int ready = read_ahead_end_ > read_ahead_begin_ ? 1 : receiveIsReady(tcp_socket_);
         if (ready == 0) {
           // No messages on the socket, continue with the handler main loop.
           break;
@@ -390,7 +480,11 @@ namespace tcp_io_device {
           setSocketInvalid(tcp_socket_);
           break;
         }
-        auto in_msg = receiveMessage();
+        bool consumed = false;
+        auto in_msg = receiveMessage(consumed);
+        if (consumed) {
+          continue;
+        }
         if (!in_msg) {
           // Something went wrong when receiving the message, break the handler, end the thread.
           // got_error = true;
@@ -399,6 +493,20 @@ namespace tcp_io_device {
           break;
         }
 
+        // Unpack batches, so the main thread only sees DATA messages.
+        if (in_msg->messagetype() == TCPMessage_Type_BATCH && unpack_batches_) {
+          BatchMessage* batch = in_msg->mutable_batchmessage();
+          for (int i = 0; i < batch->datamessages_size(); ++i) {
+            std::unique_ptr<TCPMessage> data_msg = std::make_unique<TCPMessage>();
+            data_msg->set_messagetype(TCPMessage_Type_DATA);
+            // Batches of older senders carry only the timestamp of their first DataMessage.
+            data_msg->set_timestamp(i < batch->timestamps_size() ? batch->timestamps(i) : in_msg->timestamp());
+            data_msg->mutable_datamessage()->Swap(batch->mutable_datamessages(i));
+            incoming_queue_->enqueue(std::move(data_msg));
+          }
+          continue;
+        }
+
         // Add it to the queue, let the main thread handle them
         incoming_queue_->enqueue(std::move(in_msg));
       }
@@ -429,17 +537,34 @@ namespace tcp_io_device {
     setSocketInvalid(tcp_socket_);
   }
 
-  std::unique_ptr<TCPMessage> TCPConnection::receiveMessage()
+  std::unique_ptr<TCPMessage> TCPConnection::receiveMessage(bool& consumed)
   {
+    consumed = false;
+    bool lazy = (bool)lazy_message_handler_;
+
+    if (varint_framing_) {
+      const char* frame = NULL;
+      uint64_t frame_len = 0;
+      if (!receiveDelimitedFrame(&frame, &frame_len)) {
+        return NULL;
+      }
+      if (!lazy) {
+        return parseFrame(frame, frame_len, false, 0, NULL, consumed);
+      }
+      // The read-ahead buffer is reused, lazy messages need a frame of their own.
+      std::shared_ptr<AlignedBuffer> lazy_frame = acquireFrame(frame_len);
+      memcpy(lazy_frame->data(), frame, frame_len);
+      return parseFrame(lazy_frame->data(), frame_len, false, 0, lazy_frame, consumed);
+    }
+
     // Number of bytes received
     int received_bytes = 0;
 
     // Length of read bytes in total (used to ensure split messages are read correctly)
     uint64_t len_res = 0;
 
-    // First read the length of the message to expect (8 byte uint64_t)
-    std::string tcp_msg_len_recv_buf;
-    tcp_msg_len_recv_buf.reserve(msg_length_buf_size_);
+    // First read the length of the message to expect (8 byte uint64_t), or the start of a FrameHeader
+    std::vector<char> tcp_msg_len_recv_buf(std::max<uint64_t>(msg_length_buf_size_, FrameHeader::SIZE));
     // To ensure split message is read correctly
     while (len_res < msg_length_buf_size_) {
       received_bytes = recv(tcp_socket_, &(tcp_msg_len_recv_buf[len_res]), msg_length_buf_size_ - len_res, 0);
@@ -466,19 +591,83 @@ namespace tcp_io_device {
       }
     }
 
-    // Convert the read bytes to uint64_t. Little Endian! Otherwise invert for loop - not implemented, yet.
     uint64_t msg_len = 0;
-    for (int i = msg_length_buf_size_ - 1; i >= 0; --i)
-    {
-      msg_len <<= 8;
-      msg_len |= (unsigned char)tcp_msg_len_recv_buf[i];
+    uint8_t flags = 0;
+    FrameHeader header;
+    bool has_header = msg_length_buf_size_ == 8 && FrameHeader::detect(tcp_msg_len_recv_buf.data());
+    if (has_header) {
+      // Read the rest of the FrameHeader.
+      if (!receiveBytes(&tcp_msg_len_recv_buf[msg_length_buf_size_], FrameHeader::SIZE - msg_length_buf_size_)) {
+        return NULL;
+      }
+      header.read(tcp_msg_len_recv_buf.data());
+      msg_len = header.length;
+      flags = header.flags;
+      // TCP does not lose frames within a connection, a gap means frames were lost in a reconnect.
+      if (receive_sequence_valid_ && header.sequence != receive_sequence_ + 1) {
+        if (header.sequence > receive_sequence_ + 1) {
+          uint64_t lost = header.sequence - receive_sequence_ - 1;
+          lost_frames_ += lost;
+          std::cout << "WARNING: " << lost << " frames of the peer were lost" << std::endl;
+        }
+        else {
+          std::cout << "INFO: The peer restarted its frame sequence" << std::endl;
+        }
+      }
+      receive_sequence_ = header.sequence;
+      receive_sequence_valid_ = true;
+    }
+    else {
+      // Convert the read bytes to uint64_t. The length is always sent little endian, independent of the host byte order.
+      for (int i = msg_length_buf_size_ - 1; i >= 0; --i)
+      {
+        msg_len <<= 8;
+        msg_len |= (unsigned char)tcp_msg_len_recv_buf[i];
+      }
+      // The most significant byte of the length prefix holds the frame flags.
+      if (msg_length_buf_size_ == 8) {
+        flags = (uint8_t)(msg_len >> 56);
+        msg_len &= 0x00FFFFFFFFFFFFFFull;
+      }
     }
+    bool compressed = (flags & (FRAME_LZ4 | FRAME_ZSTD)) != 0;
 
     // Reset read bytes and total read bytes to 0
     received_bytes = 0;
     len_res = 0;
     // Read as many packages as needed to fill the message buffer. Ensures split messages are received correctly.
-    char* buf = new char[msg_len]();
+    // Compressed frames are read aside and decompressed into the receive buffer. In lazy mode, frames are read into
+    // a pooled frame which stays alive as long as payloads are borrowed from it.
+    std::shared_ptr<AlignedBuffer> lazy_frame;
+    AlignedBuffer* frame_buffer = &receive_buffer_;
+    if (compressed) {
+      frame_buffer = &compressed_buffer_;
+    }
+    else if (lazy) {
+      lazy_frame = acquireFrame(msg_len + AlignedBuffer::alignment);
+      frame_buffer = lazy_frame.get();
+    }
+    if (frame_buffer->size() < msg_len) {
+      frame_buffer->resize(msg_len);
+    }
+    char* buf = frame_buffer->data();
+    if (lazy_frame) {
+      // Read the start of the message first, and place the message so the first large RAW payload is aligned for its
+      // data type. It can then be borrowed by MsgData instead of being copied.
+      const size_t prefix_size = 1024;
+      char prefix[prefix_size];
+      uint64_t prefix_len = std::min<uint64_t>(msg_len, prefix_size);
+      if (!receiveBytes(prefix, prefix_len)) {
+        return NULL;
+      }
+      size_t offset = 0;
+      size_t alignment = 1;
+      if (LazyMessage::locatePayload(prefix, prefix_len, prefix_size, offset, alignment)) {
+        buf += (alignment - offset % alignment) % alignment;
+      }
+      memcpy(buf, prefix, prefix_len);
+      len_res = prefix_len;
+    }
     while (len_res < msg_len) {
       received_bytes = recv(tcp_socket_, &buf[len_res], msg_len - len_res, 0);
       if (received_bytes > 0) {
@@ -492,29 +681,318 @@ namespace tcp_io_device {
         return NULL;
       }
     }
-
-    // Parse the byte-stream into a TCPMessage
-    std::unique_ptr<TCPMessage> msg = std::make_unique<TCPMessage>();
-    if (!msg->ParseFromArray(buf, msg_len)) {
-      std::cout << "ERROR: Parsing Message from String failed" << std::endl;
+    if (has_header && frame_filter_ && !frame_filter_(header)) {
+      consumed = true;
       return NULL;
     }
+    if (compressed) {
+      AlignedBuffer* target = &receive_buffer_;
+      if (lazy) {
+        lazy_frame = acquireFrame(0);
+        target = lazy_frame.get();
+      }
+      if (!decompressFrame(flags, buf, msg_len, *target, msg_len)) {
+        std::cout << "ERROR: Decompressing frame with flags " << (int)flags << " failed" << std::endl;
+        return NULL;
+      }
+      buf = target->data();
+    }
 
-    delete[] buf;
+    return parseFrame(buf, msg_len, has_header, flags, lazy_frame, consumed);
+  }
+
+  std::unique_ptr<TCPMessage> TCPConnection::parseFrame(const char* buf, uint64_t len, bool has_header, uint8_t flags,
+    std::shared_ptr<AlignedBuffer> lazy_frame, bool& consumed)
+  {
+    if (variable_sink_) {
+      if (schema_decoder_.decode(buf, len, peer_byte_order_, *variable_sink_)) {
+        consumed = true;
+        return NULL;
+      }
+      // The sink takes precedence over the lazy message handler.
+      lazy_frame = NULL;
+    }
+
+    std::unique_ptr<TCPMessage> msg;
+    if (lazy_frame) {
+      std::unique_ptr<LazyMessage> lazy = LazyMessage::parse(lazy_frame, buf, len, variable_filter_.get());
+      if (!lazy) {
+        std::cout << "ERROR: Parsing Message from String failed" << std::endl;
+        return NULL;
+      }
+      TCPMessage_Type type = lazy->getMessage().messagetype();
+      if (type == TCPMessage_Type_DATA || type == TCPMessage_Type_BATCH) {
+        processReceivedMessage(&lazy->getMessage(), has_header, flags);
+        lazy_message_handler_(std::move(lazy));
+        consumed = true;
+        return NULL;
+      }
+      // Other messages have no payloads left in the frame.
+      msg = lazy->releaseMessage();
+    }
+    else if (variable_filter_) {
+      // Only the payloads of the accepted variables are copied out of the frame.
+      std::unique_ptr<LazyMessage> lazy = LazyMessage::parse(NULL, buf, len, variable_filter_.get());
+      if (!lazy) {
+        std::cout << "ERROR: Parsing Message from String failed" << std::endl;
+        return NULL;
+      }
+      msg = lazy->materialize();
+    }
+    else {
+      // Parse the byte-stream into a TCPMessage
+      msg = std::make_unique<TCPMessage>();
+      if (!msg->ParseFromArray(buf, len)) {
+        std::cout << "ERROR: Parsing Message from String failed" << std::endl;
+        return NULL;
+      }
+    }
+
+    processReceivedMessage(msg.get(), has_header, flags);
+
+    if (variable_sink_ && (msg->messagetype() == TCPMessage_Type_DATA || msg->messagetype() == TCPMessage_Type_BATCH)) {
+      schema_decoder_.decode(*msg, peer_byte_order_, *variable_sink_);
+      consumed = true;
+      return NULL;
+    }
 
     return msg;
   }
 
+  std::shared_ptr<AlignedBuffer> TCPConnection::acquireFrame(uint64_t size)
+  {
+    // Frames still referenced by a LazyMessage or a borrowing MsgData are skipped.
+    const size_t max_pooled_frames = 8;
+    std::shared_ptr<AlignedBuffer> frame;
+    for (const std::shared_ptr<AlignedBuffer>& pooled : frame_pool_) {
+      if (pooled.use_count() == 1) {
+        frame = pooled;
+        break;
+      }
+    }
+    if (!frame) {
+      frame = std::make_shared<AlignedBuffer>();
+      if (frame_pool_.size() < max_pooled_frames) {
+        frame_pool_.push_back(frame);
+      }
+    }
+    if (frame->size() < size) {
+      frame->resize(size);
+    }
+    return frame;
+  }
+
+  void TCPConnection::processReceivedMessage(TCPMessage* msg, bool has_header, uint8_t flags)
+  {
+    // Remember the byte order of the peer, used to convert the data of its DataMessages.
+    if (msg->messagetype() == TCPMessage_Type_SETUP) {
+      peer_byte_order_ = msg->setupmessage().byteorder();
+      uint32_t peer_compressions = 0;
+      for (int i = 0; i < msg->setupmessage().supportedcompressions_size(); ++i) {
+        peer_compressions |= 1u << msg->setupmessage().supportedcompressions(i);
+      }
+      peer_compressions_ = peer_compressions;
+      std::shared_ptr<const SetupTables> setup_tables = std::make_shared<SetupTables>(msg->setupmessage());
+      std::shared_ptr<const CommandTemplateCache> command_templates = std::make_shared<CommandTemplateCache>(msg->setupmessage());
+      {
+        std::lock_guard<std::mutex> lock(setup_mutex_);
+        setup_tables_ = setup_tables;
+        command_templates_ = command_templates;
+      }
+      if (variable_sink_) {
+        variable_sink_->onSetup(setup_tables);
+      }
+    }
+    else if (msg->messagetype() == TCPMessage_Type_START) {
+      peer_byte_order_ = msg->startmessage().byteorder();
+      if (msg->startmessage().timeseriescodec()) {
+        time_series_codec_enabled_ = true;
+      }
+      if (msg->startmessage().framedelta()) {
+        frame_delta_enabled_ = true;
+      }
+      if (msg->startmessage().compression() != StartMessage_Compression_NO_COMPRESSION) {
+        compression_threshold_ = msg->startmessage().compressionthreshold();
+        compression_ = msg->startmessage().compression();
+      }
+      if (msg->startmessage().frameheader()) {
+        frame_header_enabled_ = true;
+      }
+      // All following frames of the peer are varint delimited.
+      if (msg->startmessage().framing() == StartMessage_Framing_VARINT_DELIMITED) {
+        varint_framing_ = true;
+      }
+      if (msg->startmessage().maxbatchsize() > 1) {
+        batch_max_latency_us_ = msg->startmessage().maxbatchlatencyus();
+        batch_max_size_ = msg->startmessage().maxbatchsize();
+      }
+    }
+    else if (msg->messagetype() == TCPMessage_Type_SUBSCRIPTION) {
+      subscription_filter_.setSubscription(msg->subscriptionmessage());
+      std::shared_ptr<const SubscriptionMessage> subscription = std::make_shared<SubscriptionMessage>(msg->subscriptionmessage());
+      std::lock_guard<std::mutex> lock(setup_mutex_);
+      subscription_ = subscription;
+    }
+    else if (msg->messagetype() == TCPMessage_Type_DATA) {
+      // Undo the codecs in the reverse order of sendMessage. The FrameHeader tells if they were applied.
+      if (!has_header || (flags & FRAME_TIME_SERIES)) {
+        incoming_codec_.decode(msg->mutable_datamessage(), peer_byte_order_);
+      }
+      if (!has_header || (flags & FRAME_DELTA)) {
+        incoming_frame_delta_.decode(msg->mutable_datamessage());
+      }
+    }
+    else if (msg->messagetype() == TCPMessage_Type_BATCH) {
+      // The DataMessages were coded in order, decode them in the same order.
+      for (int i = 0; i < msg->batchmessage().datamessages_size(); ++i) {
+        DataMessage* data_msg = msg->mutable_batchmessage()->mutable_datamessages(i);
+        if (!has_header || (flags & FRAME_TIME_SERIES)) {
+          incoming_codec_.decode(data_msg, peer_byte_order_);
+        }
+        if (!has_header || (flags & FRAME_DELTA)) {
+          incoming_frame_delta_.decode(data_msg);
+        }
+      }
+    }
+  }
+
   int TCPConnection::sendMessage(std::unique_ptr<TCPMessage> msg)
   {
+    uint8_t flags = 0;
+    // The StartMessage itself is still sent without FrameHeader and with the length prefix.
+    bool enable_frame_header = false;
+    bool enable_varint_framing = false;
+    // Announce the byte order of the numeric values sent by this side.
+    if (msg->messagetype() == TCPMessage_Type_SETUP) {
+      msg->mutable_setupmessage()->set_byteorder(hostByteOrder());
+      msg->mutable_setupmessage()->clear_supportedcompressions();
+      for (StartMessage_Compression compression : supportedCompressions()) {
+        msg->mutable_setupmessage()->add_supportedcompressions(compression);
+      }
+    }
+    else if (msg->messagetype() == TCPMessage_Type_START) {
+      msg->mutable_startmessage()->set_byteorder(hostByteOrder());
+      if (time_series_codec_requested_) {
+        msg->mutable_startmessage()->set_timeseriescodec(true);
+        time_series_codec_enabled_ = true;
+      }
+      if (frame_delta_requested_) {
+        msg->mutable_startmessage()->set_framedelta(true);
+        frame_delta_enabled_ = true;
+      }
+      // Only request a compression both sides are able to handle.
+      StartMessage_Compression compression = compression_requested_;
+      if (compression != StartMessage_Compression_NO_COMPRESSION) {
+        bool supported = false;
+        for (StartMessage_Compression c : supportedCompressions()) {
+          supported |= c == compression;
+        }
+        if (supported && (peer_compressions_ & (1u << compression))) {
+          msg->mutable_startmessage()->set_compression(compression);
+          msg->mutable_startmessage()->set_compressionthreshold(compression_threshold_requested_);
+          compression_threshold_ = compression_threshold_requested_.load();
+          compression_ = compression;
+        }
+        else {
+          std::cout << "WARNING: Compression " << StartMessage_Compression_Name(compression)
+            << " is not supported by both sides, sending uncompressed frames" << std::endl;
+        }
+      }
+      if (frame_header_requested_) {
+        msg->mutable_startmessage()->set_frameheader(true);
+        enable_frame_header = true;
+      }
+      if (varint_framing_requested_) {
+        msg->mutable_startmessage()->set_framing(StartMessage_Framing_VARINT_DELIMITED);
+        enable_varint_framing = true;
+      }
+      if (batch_max_size_requested_ > 1) {
+        msg->mutable_startmessage()->set_maxbatchsize(batch_max_size_requested_);
+        msg->mutable_startmessage()->set_maxbatchlatencyus(batch_max_latency_us_requested_);
+        batch_max_latency_us_ = batch_max_latency_us_requested_.load();
+        batch_max_size_ = batch_max_size_requested_.load();
+      }
+    }
+    else if (msg->messagetype() == TCPMessage_Type_DATA) {
+      // Frame delta first, so large variables are not also coded by the time series codec.
+      if (frame_delta_enabled_) {
+        outgoing_frame_delta_.encode(msg->mutable_datamessage());
+        flags |= FRAME_DELTA;
+      }
+      if (time_series_codec_enabled_) {
+        outgoing_codec_.encode(msg->mutable_datamessage());
+        flags |= FRAME_TIME_SERIES;
+      }
+    }
+    else if (msg->messagetype() == TCPMessage_Type_BATCH) {
+      for (int i = 0; i < msg->batchmessage().datamessages_size(); ++i) {
+        DataMessage* data_msg = msg->mutable_batchmessage()->mutable_datamessages(i);
+        if (frame_delta_enabled_) {
+          outgoing_frame_delta_.encode(data_msg);
+          flags |= FRAME_DELTA;
+        }
+        if (time_series_codec_enabled_) {
+          outgoing_codec_.encode(data_msg);
+          flags |= FRAME_TIME_SERIES;
+        }
+      }
+    }
+
     // Serialize the TCPMessage
     std::string out;
     out = msg->SerializeAsString();
 
-    // First put the length of the message in the first 8 bytes of the output stream
-    std::string out_buffer = "";
-    for (int i = 0; i < 8; ++i) {
-      out_buffer += (unsigned char)((int)(((uint64_t)out.size() >> (i * 8)) & 0xFF));
+    int i_send_result = sendFrame(msg->messagetype(), flags, out);
+    if (enable_frame_header) {
+      frame_header_enabled_ = true;
+    }
+    if (enable_varint_framing) {
+      varint_framing_ = true;
+    }
+    return i_send_result;
+  }
+
+  int TCPConnection::sendFrame(TCPMessage_Type type, uint8_t flags, std::string& out)
+  {
+    // Frames are sent with a FrameHeader from the frame following the StartMessage on.
+    bool send_header = frame_header_enabled_ && msg_length_buf_size_ == 8 && !varint_framing_;
+    bool varint_framing = varint_framing_;
+
+    // Compress large frames, unless it does not pay off.
+    StartMessage_Compression compression = compression_;
+    if (!varint_framing && compression != StartMessage_Compression_NO_COMPRESSION && out.size() >= compression_threshold_) {
+      std::string compressed;
+      if (compressFrame(compression, out, compressed) && compressed.size() < out.size()) {
+        out.swap(compressed);
+        flags |= compression == StartMessage_Compression_LZ4 ? FRAME_LZ4 : FRAME_ZSTD;
+      }
+    }
+
+    std::string& out_buffer = send_buffer_;
+    out_buffer.clear();
+    if (varint_framing) {
+      // The varint length prefix of SerializeDelimitedTo.
+      uint8_t prefix[10];
+      uint8_t* prefix_end = google::protobuf::io::CodedOutputStream::WriteVarint64ToArray(out.size(), prefix);
+      out_buffer.append((const char*)prefix, prefix_end - prefix);
+    }
+    else if (send_header) {
+      FrameHeader header;
+      header.type = (uint8_t)type;
+      header.flags = flags;
+      header.length = out.size();
+      header.sequence = ++send_sequence_;
+      header.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+      header.write(out_buffer);
+    }
+    else {
+      // First put the length of the message in the first 8 bytes of the output stream, the compression flags in the
+      // most significant byte.
+      uint64_t length_word = (uint64_t)out.size() | ((uint64_t)(flags & (FRAME_LZ4 | FRAME_ZSTD)) << 56);
+      for (int i = 0; i < 8; ++i) {
+        out_buffer += (unsigned char)((length_word >> (i * 8)) & 0xFF);
+      }
     }
 
     // Attach the serialized message to the byte-stream
@@ -535,6 +1013,213 @@ namespace tcp_io_device {
     return i_send_result;
   }
 
+  int TCPConnection::batchMessage(std::unique_ptr<TCPMessage> msg)
+  {
+    if (!pending_batch_) {
+      pending_batch_ = std::make_unique<TCPMessage>();
+      pending_batch_->set_messagetype(TCPMessage_Type_BATCH);
+      pending_batch_->set_timestamp(msg->timestamp());
+      pending_batch_start_ = std::chrono::steady_clock::now();
+    }
+    pending_batch_->mutable_batchmessage()->add_datamessages()->Swap(msg->mutable_datamessage());
+    pending_batch_->mutable_batchmessage()->add_timestamps(msg->timestamp());
+    if (pending_batch_->batchmessage().datamessages_size() >= (int)batch_max_size_) {
+      return flushBatch();
+    }
+    return 1;
+  }
+
+  int TCPConnection::flushBatch()
+  {
+    if (!pending_batch_) {
+      return 1;
+    }
+    std::unique_ptr<TCPMessage> msg = std::move(pending_batch_);
+    if (msg->batchmessage().datamessages_size() == 1) {
+      // A batch of one is sent as a plain DATA message.
+      std::unique_ptr<TCPMessage> data_msg = std::make_unique<TCPMessage>();
+      data_msg->set_messagetype(TCPMessage_Type_DATA);
+      data_msg->set_timestamp(msg->timestamp());
+      data_msg->mutable_datamessage()->Swap(msg->mutable_batchmessage()->mutable_datamessages(0));
+      return sendMessage(std::move(data_msg));
+    }
+    return sendMessage(std::move(msg));
+  }
+
+  bool TCPConnection::receiveBytes(char* buf, uint64_t len)
+  {
+    uint64_t len_res = 0;
+    while (len_res < len) {
+      int received_bytes = recv(tcp_socket_, &buf[len_res], len - len_res, 0);
+      if (received_bytes > 0) {
+        len_res += received_bytes;
+      }
+      else if (received_bytes == 0) {
+        std::cout << "Connection closing..." << std::endl;
+        return false;
+      }
+      else {
+        std::cout << "recv failed during recv of frame header with error: " << getLastError() << std::endl;
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool TCPConnection::receiveDelimitedFrame(const char** frame, uint64_t* frame_len)
+  {
+    // Receive at least this many bytes at once, so small frames are read ahead with a single recv.
+    const size_t read_ahead_size = 64 * 1024;
+    while (true) {
+      size_t available = read_ahead_end_ - read_ahead_begin_;
+      size_t needed = available + 1;
+      if (available > 0) {
+        google::protobuf::io::CodedInputStream in((const uint8_t*)&read_ahead_[read_ahead_begin_], (int)std::min<size_t>(available, INT_MAX));
+        uint64_t len = 0;
+        if (in.ReadVarint64(&len)) {
+          size_t prefix_len = in.CurrentPosition();
+          if (len > INT_MAX) {
+            std::cout << "ERROR: Varint delimited frame of " << len << " bytes exceeds the protobuf limit" << std::endl;
+            return false;
+          }
+          if (available >= prefix_len + len) {
+            *frame = &read_ahead_[read_ahead_begin_ + prefix_len];
+            *frame_len = len;
+            read_ahead_begin_ += prefix_len + len;
+            return true;
+          }
+          needed = prefix_len + len;
+        }
+        else if (available >= 10) {
+          std::cout << "ERROR: Corrupt varint length prefix" << std::endl;
+          return false;
+        }
+      }
+
+      // Move the incomplete frame to the front and make room for the rest of it.
+      if (read_ahead_begin_ > 0) {
+        memmove(read_ahead_.data(), &read_ahead_[read_ahead_begin_], available);
+        read_ahead_begin_ = 0;
+        read_ahead_end_ = available;
+      }
+      if (read_ahead_.size() < std::max(needed, read_ahead_size)) {
+        read_ahead_.resize(std::max(needed, read_ahead_size));
+      }
+      int received_bytes = recv(tcp_socket_, &read_ahead_[read_ahead_end_], read_ahead_.size() - read_ahead_end_, 0);
+      if (received_bytes > 0) {
+        read_ahead_end_ += received_bytes;
+      }
+      else if (received_bytes == 0) {
+        std::cout << "Connection closing..." << std::endl;
+        return false;
+      }
+      else {
+        std::cout << "recv failed during recv of data message with error: " << getLastError() << std::endl;
+        return false;
+      }
+    }
+  }
+
+  std::vector<StartMessage_Compression> TCPConnection::supportedCompressions()
+  {
+    std::vector<StartMessage_Compression> compressions;
+#ifdef ENABLE_LZ4
+    compressions.push_back(StartMessage_Compression_LZ4);
+#endif
+#ifdef ENABLE_ZSTD
+    compressions.push_back(StartMessage_Compression_ZSTD);
+#endif
+    return compressions;
+  }
+
+  bool TCPConnection::compressFrame(StartMessage_Compression compression, const std::string& in, std::string& out)
+  {
+    // The uncompressed size is stored in front of the compressed data, little endian.
+    out.clear();
+    for (int i = 0; i < 8; ++i) {
+      out += (unsigned char)(((uint64_t)in.size() >> (i * 8)) & 0xFF);
+    }
+    switch (compression)
+    {
+#ifdef ENABLE_LZ4
+    case StartMessage_Compression_LZ4: {
+      if (in.size() > LZ4_MAX_INPUT_SIZE) {
+        return false;
+      }
+      out.resize(8 + LZ4_compressBound((int)in.size()));
+      int size = LZ4_compress_default(in.data(), &out[8], (int)in.size(), (int)(out.size() - 8));
+      if (size <= 0) {
+        return false;
+      }
+      out.resize(8 + size);
+      return true;
+    }
+#endif
+#ifdef ENABLE_ZSTD
+    case StartMessage_Compression_ZSTD: {
+      out.resize(8 + ZSTD_compressBound(in.size()));
+      size_t size = ZSTD_compress(&out[8], out.size() - 8, in.data(), in.size(), ZSTD_CLEVEL_DEFAULT);
+      if (ZSTD_isError(size)) {
+        return false;
+      }
+      out.resize(8 + size);
+      return true;
+    }
+#endif
+    default:
+      return false;
+    }
+  }
+
+  bool TCPConnection::decompressFrame(uint8_t flags, const char* in, uint64_t in_len, AlignedBuffer& out, uint64_t& out_len)
+  {
+    if (in_len < 8) {
+      return false;
+    }
+    uint64_t size = 0;
+    for (int i = 7; i >= 0; --i) {
+      size <<= 8;
+      size |= (unsigned char)in[i];
+    }
+    in += 8;
+    in_len -= 8;
+#ifdef ENABLE_LZ4
+    if (flags & FRAME_LZ4) {
+      // LZ4 cannot expand by more than a factor of 255, reject corrupt sizes before allocating.
+      if (size > LZ4_MAX_INPUT_SIZE || size > in_len * 255 + 16) {
+        return false;
+      }
+      if (out.size() < size) {
+        out.resize(size);
+      }
+      int result = LZ4_decompress_safe(in, out.data(), (int)in_len, (int)size);
+      out_len = size;
+      return result >= 0 && (uint64_t)result == size;
+    }
+#endif
+#ifdef ENABLE_ZSTD
+    if (flags & FRAME_ZSTD) {
+      // ZSTD_compress stores the content size in the frame header, it has to match.
+      if (ZSTD_getFrameContentSize(in, in_len) != size) {
+        return false;
+      }
+      if (out.size() < size) {
+        out.resize(size);
+      }
+      size_t result = ZSTD_decompress(out.data(), size, in, in_len);
+      out_len = size;
+      return !ZSTD_isError(result) && result == size;
+    }
+#endif
+#if !defined(ENABLE_LZ4) && !defined(ENABLE_ZSTD)
+    // No compression compiled in, every compressed frame is rejected.
+    (void)flags;
+    (void)out;
+    (void)out_len;
+#endif
+    return false;
+  }
+
 #if defined(_WIN32)
   int TCPConnection::receiveIsReady(SOCKET fd)
 #else
@@ -578,7 +1263,10 @@ namespace tcp_io_device {
   { {TCPMessage_Type_DATA, "DATA"},
     {TCPMessage_Type_SETUP, "SETUP"},
     {TCPMessage_Type_START, "START"},
-    {TCPMessage_Type_STOP, "STOP"} };
+    {TCPMessage_Type_STOP, "STOP"},
+    {TCPMessage_Type_RECONNECT, "RECONNECT"},
+    {TCPMessage_Type_BATCH, "BATCH"},
+    {TCPMessage_Type_SUBSCRIPTION, "SUBSCRIPTION"} };
 
 } // namespace tcp_io_device
 
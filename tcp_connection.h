@@ -69,9 +69,22 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <thread>
+#include <atomic>
 #include <bitset>
+#include <vector>
+#include <functional>
+#include <chrono>
 
 #include "tcp_data_message.pb.h"
+#include "utils.h"
+#include "time_series_codec.h"
+#include "frame_delta_codec.h"
+#include "frame_header.h"
+#include "lazy_message.h"
+#include "schema_decoder.h"
+#include "wire_encoder.h"
+#include "command_template.h"
+#include "subscription_filter.h"
 
 namespace tcp_io_device {
 
@@ -118,8 +131,25 @@ namespace tcp_io_device {
           queue_.front()->release_datamessage();
         }
         queue_.pop();
+        encoded_.pop();
       }
       queue_.push(std::move(t));
+      encoded_.push(std::string());
+    }
+
+    /**
+    * Adds a serialized DATA TCPMessage (see WireEncoder) to the queue. The TCPConnection sends the bytes as they are,
+    * unless the time series codec, frame delta coding or batching need the parsed message. Deletes old messages like
+    * enqueue.
+    * \param encoded The serialized message.
+    */
+    void enqueueEncoded(std::string encoded)
+    {
+      std::lock_guard<std::recursive_mutex> lock(mutex_);
+      std::unique_ptr<TCPMessage> t = std::make_unique<TCPMessage>();
+      t->set_messagetype(TCPMessage_Type_DATA);
+      enqueue(std::move(t));
+      encoded_.back().swap(encoded);
     }
 
 
@@ -135,6 +165,30 @@ namespace tcp_io_device {
       }
       std::unique_ptr<TCPMessage> val = std::move(queue_.front());
       queue_.pop();
+      if (!encoded_.front().empty()) {
+        val->ParseFromString(encoded_.front());
+      }
+      encoded_.pop();
+      return val;
+    }
+
+    /**
+    * Returns the front element (oldest) of the queue and deletes it. Messages added with enqueueEncoded are not parsed,
+    * their bytes are returned in encoded together with a TCPMessage only carrying the message type.
+    * \param encoded Set to the serialized message, empty for messages added with enqueue.
+    * \return Oldest message in the queue.
+    */
+    std::unique_ptr<TCPMessage> dequeue(std::string& encoded)
+    {
+      std::lock_guard<std::recursive_mutex> lock(mutex_);
+      encoded.clear();
+      if (queue_.empty()) {
+        return NULL;
+      }
+      std::unique_ptr<TCPMessage> val = std::move(queue_.front());
+      queue_.pop();
+      encoded.swap(encoded_.front());
+      encoded_.pop();
       return val;
     }
 
@@ -149,12 +203,15 @@ namespace tcp_io_device {
         }
         queue_.pop();
       }
+      encoded_ = std::queue<std::string>();
     }
 
 
 
   private:
     std::queue<std::unique_ptr<TCPMessage>> queue_;
+    // The bytes of the messages added with enqueueEncoded, empty for the others. Always as long as queue_.
+    std::queue<std::string> encoded_;
     mutable std::recursive_mutex mutex_;
     int max_elements_;
   };
@@ -210,6 +267,172 @@ namespace tcp_io_device {
     */
     bool isRunning() { return state_ == RUNNING; }
 
+    /**
+    * Returns the byte order announced by the peer in its last SetupMessage or StartMessage. Pass it to the MsgData
+    * constructor, so numeric values of a peer with a different byte order are converted.
+    * \return The byte order of the peer, LITTLE until the peer announced its byte order.
+    */
+    TCPMessage_ByteOrder getPeerByteOrder() { return peer_byte_order_; }
+
+    /**
+    * Requests the time series codec (see TimeSeriesCodec) in the next StartMessage sent through this connection. Once the
+    * StartMessage is sent (or received with the request set by the peer), RAW DOUBLE, INT64 and COMMUNICATION_ID
+    * variables of outgoing DataMessages are coded against their previous frame. Incoming coded variables are always
+    * decoded before they are enqueued.
+    */
+    void requestTimeSeriesCodec() { time_series_codec_requested_ = true; }
+
+    /**
+    * Requests frame delta coding (see FrameDeltaCodec) in the next StartMessage sent through this connection. Once the
+    * StartMessage is sent (or received with the request set by the peer), large RAW variables of outgoing DataMessages
+    * are sent as changed byte ranges. Incoming delta frames are always reconstructed before they are enqueued.
+    */
+    void requestFrameDelta() { frame_delta_requested_ = true; }
+
+    /**
+    * Sets the sender parameters of the frame delta coding. Call before start().
+    * \param keyframe_interval The maximum number of delta frames between two keyframes (default 30).
+    * \param min_size Variables with less bytes of data are sent unchanged (default 1024).
+    */
+    void configureFrameDelta(uint32_t keyframe_interval, uint64_t min_size) { outgoing_frame_delta_.configure(keyframe_interval, min_size); }
+
+    /**
+    * Requests frame compression in the next StartMessage sent through this connection. The request is only sent if the
+    * compression is compiled in (ENABLE_LZ4 / ENABLE_ZSTD) and the peer listed it in its SetupMessage. Once the
+    * StartMessage is sent (or received with the request set by the peer), frames of at least threshold bytes are
+    * compressed, unless compression does not make them smaller.
+    * \param compression LZ4 for low latency, ZSTD for a better ratio.
+    * \param threshold The minimum size in bytes of a serialized frame to be compressed.
+    */
+    void requestCompression(StartMessage_Compression compression, uint64_t threshold) {
+      compression_requested_ = compression;
+      compression_threshold_requested_ = threshold;
+    }
+
+    /**
+    * Returns the frame compressions compiled into this build. Announced in every SetupMessage sent.
+    * \return The supported compressions, empty if neither ENABLE_LZ4 nor ENABLE_ZSTD is defined.
+    */
+    static std::vector<StartMessage_Compression> supportedCompressions();
+
+    /**
+    * Requests the FrameHeader (see frame_header.h) in the next StartMessage sent through this connection. Once the
+    * StartMessage is sent (or received with the request set by the peer), every frame is sent with a FrameHeader.
+    * Incoming frames with a FrameHeader are always accepted.
+    */
+    void requestFrameHeader() { frame_header_requested_ = true; }
+
+    /**
+    * Sets a filter called by the background thread for every incoming frame with a FrameHeader, before the payload is
+    * decompressed or parsed. Frames for which the filter returns false are discarded. Do not discard DATA frames while
+    * the time series codec or frame delta coding is enabled, their state depends on every frame. Call before start().
+    * \param filter The filter, an empty function accepts all frames.
+    */
+    void setFrameFilter(std::function<bool(const FrameHeader&)> filter) { frame_filter_ = filter; }
+
+    /**
+    * Returns the number of frames of the peer which never arrived, detected by gaps in the FrameHeader sequence
+    * numbers (e.g. frames lost in a reconnect).
+    * \return The number of lost frames.
+    */
+    uint64_t getLostFrames() { return lost_frames_; }
+
+    /**
+    * Requests VARINT_DELIMITED framing in the next StartMessage sent through this connection. Each side switches once
+    * the StartMessage is sent or received, so the peer must not send frames while the StartMessage is in flight. The
+    * framing saves 6-7 bytes per frame, but disables compression and the FrameHeader. Both sides fall back to the
+    * 8 byte length prefix on reconnect.
+    */
+    void requestVarintFraming() { varint_framing_requested_ = true; }
+
+    /**
+    * Requests batching in the next StartMessage sent through this connection. Once the StartMessage is sent (or
+    * received with the request set by the peer), consecutive outgoing DataMessages are grouped into BATCH frames.
+    * \param max_batch_size The maximum number of DataMessages per frame.
+    * \param max_latency_us The maximum time in microseconds a DataMessage waits for the batch to fill up.
+    */
+    void requestBatching(uint32_t max_batch_size, uint64_t max_latency_us) {
+      batch_max_size_requested_ = max_batch_size;
+      batch_max_latency_us_requested_ = max_latency_us;
+    }
+
+    /**
+    * Sets if incoming BATCH messages are unpacked into one DATA message per entry before they are enqueued (default).
+    * If false, BATCH messages are enqueued as they are, taking a single slot of the receive queue.
+    * \param unpack_batches True to unpack BATCH messages.
+    */
+    void setUnpackBatches(bool unpack_batches) { unpack_batches_ = unpack_batches; }
+
+    /**
+    * Enables the lazy mode. DATA and BATCH messages are parsed into a LazyMessage, whose RAW payloads stay in the
+    * received (refcounted) frame, and passed to the handler instead of being enqueued (BATCH messages are not
+    * unpacked). The frame is placed so the first large RAW payload is aligned for its data type. MsgData created with
+    * LazyMessage::getMsgData borrow the payloads, so large variables are not copied between socket and consumer
+    * (compressed frames are decompressed into the frame, varint delimited frames are copied into it once).
+    * The handler is called by the background thread. Call before start().
+    * \param handler The handler taking ownership of the LazyMessage, an empty function disables the lazy mode.
+    */
+    void setLazyMessageHandler(std::function<void(std::unique_ptr<LazyMessage>)> handler) { lazy_message_handler_ = handler; }
+
+    /**
+    * Sets a sink receiving the variables of all DATA and BATCH messages instead of the receive queue. The frames are
+    * decoded by a SchemaDecoder straight from the wire bytes, frames it rejects are parsed by protobuf and handed to the
+    * sink variable by variable. Takes precedence over the lazy message handler. Call before start().
+    * \param sink The sink called by the background thread, NULL to enqueue the messages.
+    */
+    void setVariableSink(std::shared_ptr<VariableSink> sink) { variable_sink_ = sink; }
+
+    /**
+    * Sets a filter applied to the received DATA and BATCH messages. The variables it rejects are skipped while the
+    * frame is decoded, their payloads are neither allocated nor copied, so they never reach the receive queue, the lazy
+    * message handler or the variable sink. The frame delta and time series codecs keep their state per variable, so
+    * they are not affected as long as the filter does not change. Call before start().
+    * \param filter The filter, NULL to receive all variables.
+    */
+    void setVariableFilter(std::shared_ptr<VariableFilter> filter) {
+      variable_filter_ = filter;
+      schema_decoder_.setFilter(filter);
+    }
+
+    /**
+    * Returns the CommandTemplates of the commands in the last SetupMessage received, built once by the background
+    * thread when the SetupMessage arrives. Encode a command with the template and pass the bytes to
+    * SafeQueue::enqueueEncoded of the send queue.
+    * \return The templates, NULL if no SetupMessage was received yet.
+    */
+    std::shared_ptr<const CommandTemplateCache> getCommandTemplates() {
+      std::lock_guard<std::mutex> lock(setup_mutex_);
+      return command_templates_;
+    }
+
+    /**
+    * Returns the flat lookup tables (names, IDs and dense variable slots) of the last SetupMessage received, built once
+    * by the background thread when the SetupMessage arrives.
+    * \return The tables, NULL if no SetupMessage was received yet.
+    */
+    std::shared_ptr<const SetupTables> getSetupTables() {
+      std::lock_guard<std::mutex> lock(setup_mutex_);
+      return setup_tables_;
+    }
+
+    /**
+    * Returns the last SubscriptionMessage received on the current connection. AERA subscribes by enqueuing a TCPMessage
+    * of type SUBSCRIPTION, the environment enforces it with a SubscriptionFilter or setSubscriptionEnforced.
+    * \return The subscription, NULL if none was received since the connection was (re)established.
+    */
+    std::shared_ptr<const SubscriptionMessage> getSubscription() {
+      std::lock_guard<std::mutex> lock(setup_mutex_);
+      return subscription_;
+    }
+
+    /**
+    * Lets the background thread enforce the SubscriptionMessage received from the peer on all outgoing DataMessages (see
+    * SubscriptionFilter), before they are coded, batched and serialized. DataMessages without any variable left are not
+    * sent. Pre-encoded DataMessages are parsed while a subscription is enforced. Call before start().
+    * \param enforced True to enforce the received subscription.
+    */
+    void setSubscriptionEnforced(bool enforced) { subscription_enforced_ = enforced; }
+
     /**
     * Check the socket if there is incoming data ready. This does not block.
     * \param fd The socket file descriptor.
@@ -256,6 +479,96 @@ namespace tcp_io_device {
     std::string host_;
     std::string port_;
 
+    std::atomic<TCPMessage_ByteOrder> peer_byte_order_;
+
+    std::atomic<bool> time_series_codec_requested_;
+    std::atomic<bool> time_series_codec_enabled_;
+    // Only used by the background thread, reset on reconnect.
+    TimeSeriesCodec outgoing_codec_;
+    TimeSeriesCodec incoming_codec_;
+
+    std::atomic<bool> frame_delta_requested_;
+    std::atomic<bool> frame_delta_enabled_;
+    // Only used by the background thread, reset on reconnect.
+    FrameDeltaCodec outgoing_frame_delta_;
+    FrameDeltaCodec incoming_frame_delta_;
+
+    std::atomic<StartMessage_Compression> compression_requested_;
+    std::atomic<uint64_t> compression_threshold_requested_;
+    // Bit (1 << compression) is set for each compression listed in the SetupMessage of the peer.
+    std::atomic<uint32_t> peer_compressions_;
+    std::atomic<StartMessage_Compression> compression_;
+    std::atomic<uint64_t> compression_threshold_;
+
+    // Pooled frame buffers, only used by the background thread. They grow to the largest frame and are reused.
+    AlignedBuffer receive_buffer_;
+    AlignedBuffer compressed_buffer_;
+    // Frames of the lazy mode, reused once no LazyMessage or MsgData borrows from them anymore.
+    std::vector<std::shared_ptr<AlignedBuffer>> frame_pool_;
+    std::function<void(std::unique_ptr<LazyMessage>)> lazy_message_handler_;
+
+    std::shared_ptr<VariableSink> variable_sink_;
+    std::shared_ptr<VariableFilter> variable_filter_;
+
+    // Replaced by the background thread on every SetupMessage received.
+    std::shared_ptr<const CommandTemplateCache> command_templates_;
+    std::shared_ptr<const SetupTables> setup_tables_;
+    // Replaced by the background thread on every SubscriptionMessage received, reset on reconnect.
+    std::shared_ptr<const SubscriptionMessage> subscription_;
+    std::mutex setup_mutex_;
+    std::atomic<bool> subscription_enforced_;
+    // Only used by the background thread.
+    SubscriptionFilter subscription_filter_;
+    // Only used by the background thread.
+    SchemaDecoder schema_decoder_;
+    std::string send_buffer_;
+
+    std::atomic<bool> frame_header_requested_;
+    std::atomic<bool> frame_header_enabled_;
+    std::atomic<uint64_t> lost_frames_;
+    // Only used by the background thread, continued across reconnects.
+    uint64_t send_sequence_;
+    uint64_t receive_sequence_;
+    bool receive_sequence_valid_;
+    std::function<bool(const FrameHeader&)> frame_filter_;
+
+    std::atomic<bool> varint_framing_requested_;
+    // Only used by the background thread, reset on reconnect.
+    bool varint_framing_;
+    // Read-ahead buffer of the VARINT_DELIMITED framing. Bytes [read_ahead_begin_, read_ahead_end_) are not parsed yet.
+    std::vector<char> read_ahead_;
+    size_t read_ahead_begin_;
+    size_t read_ahead_end_;
+
+    std::atomic<uint32_t> batch_max_size_requested_;
+    std::atomic<uint64_t> batch_max_latency_us_requested_;
+    std::atomic<uint32_t> batch_max_size_;
+    std::atomic<uint64_t> batch_max_latency_us_;
+    std::atomic<bool> unpack_batches_;
+    // Only used by the background thread. The DataMessages waiting to be sent, NULL if none.
+    std::unique_ptr<TCPMessage> pending_batch_;
+    std::chrono::steady_clock::time_point pending_batch_start_;
+
+    /**
+    * Compresses a serialized frame. The output starts with the uncompressed size (8 bytes, little endian).
+    * \param compression The compression to use.
+    * \param in The serialized frame.
+    * \param out The compressed frame.
+    * \return true on success, false if the compression is not compiled in or failed.
+    */
+    static bool compressFrame(StartMessage_Compression compression, const std::string& in, std::string& out);
+
+    /**
+    * Decompresses a frame written by compressFrame.
+    * \param flags The frame flags from the length prefix.
+    * \param in The compressed frame.
+    * \param in_len The number of bytes of the compressed frame.
+    * \param out The buffer to decompress into, resized if too small.
+    * \param out_len Set to the number of bytes of the decompressed frame.
+    * \return true on success, false if the compression is not compiled in or the frame is corrupt.
+    */
+    static bool decompressFrame(uint8_t flags, const char* in, uint64_t in_len, AlignedBuffer& out, uint64_t& out_len);
+
     /**
     * Handles the TCP connection in the background by checking for new outgoing and incoming messages, dequeueing and enqueueing the
     * SafeQueues, respectively. Repeatedly checks for new messages on the socket and parses them to TCPMessage objects. Takes TCPMessage
@@ -265,9 +578,56 @@ namespace tcp_io_device {
 
     /**
     * Method to receive data from the socket and parse them into a TCPMessage
-    * \return A unique_ptr to a TCPMessage for enqueuing it into the receive_queue_.
+    * \param consumed Set to true if the frame was discarded by the frame filter, or passed to the variable sink or the
+    * lazy message handler.
+    * \return A unique_ptr to a TCPMessage for enqueuing it into the receive_queue_. NULL on error or if consumed.
+    */
+    std::unique_ptr<TCPMessage> receiveMessage(bool& consumed);
+
+    /**
+    * Parses a received frame into a TCPMessage and processes it (see processReceivedMessage). With a variable sink, DATA
+    * and BATCH messages are passed to the sink. With a lazy frame, they are parsed into a LazyMessage and passed to
+    * the lazy message handler instead.
+    * \param buf The serialized TCPMessage.
+    * \param len The number of bytes of the serialized TCPMessage.
+    * \param has_header True if the frame was sent with a FrameHeader.
+    * \param flags The frame flags.
+    * \param lazy_frame The pooled frame holding buf in lazy mode, NULL otherwise.
+    * \param consumed Set to true if the message was passed to the variable sink or the lazy message handler.
+    * \return The TCPMessage, NULL on error or if consumed.
+    */
+    std::unique_ptr<TCPMessage> parseFrame(const char* buf, uint64_t len, bool has_header, uint8_t flags,
+      std::shared_ptr<AlignedBuffer> lazy_frame, bool& consumed);
+
+    /**
+    * Returns a pooled frame not referenced elsewhere, or a new one.
+    * \param size The minimum size of the frame.
+    */
+    std::shared_ptr<AlignedBuffer> acquireFrame(uint64_t size);
+
+    /**
+    * Receives exactly len bytes from the socket.
+    * \param buf The buffer to fill.
+    * \param len The number of bytes to receive.
+    * \return true on success, false if the connection was closed or an error occured.
+    */
+    bool receiveBytes(char* buf, uint64_t len);
+
+    /**
+    * Returns the next VARINT_DELIMITED frame, receiving into the read-ahead buffer until it is complete.
+    * \param frame Set to the serialized TCPMessage, valid until the next call.
+    * \param frame_len Set to the number of bytes of the serialized TCPMessage.
+    * \return true on success, false if the connection was closed, an error occured or the frame is corrupt.
+    */
+    bool receiveDelimitedFrame(const char** frame, uint64_t* frame_len);
+
+    /**
+    * Records the negotiation state of SETUP and START messages and undoes the codecs of DATA messages.
+    * \param msg The received message.
+    * \param has_header True if the frame was sent with a FrameHeader.
+    * \param flags The frame flags.
     */
-    std::unique_ptr<TCPMessage> receiveMessage();
+    void processReceivedMessage(TCPMessage* msg, bool has_header, uint8_t flags);
 
     /**
     * Converts a message to a byte-stream and sends it to the client.
@@ -275,6 +635,28 @@ namespace tcp_io_device {
     * \return The number of bytes sent. If <= 0 an error occured while sending the message.
     */
     int sendMessage(std::unique_ptr<TCPMessage> msg);
+
+    /**
+    * Compresses a serialized message if enabled, puts it into a frame and sends it to the client.
+    * \param type The type of the message, written to the FrameHeader.
+    * \param flags The FrameFlag bits of the codecs applied to the message.
+    * \param out The serialized message, replaced by the compressed message.
+    * \return The number of bytes sent. If <= 0 an error occured while sending the message.
+    */
+    int sendFrame(TCPMessage_Type type, uint8_t flags, std::string& out);
+
+    /**
+    * Adds an outgoing DATA message to the pending batch. Sends the batch if it is full.
+    * \param msg The DATA message.
+    * \return The number of bytes sent, 1 if the batch is not full yet. If <= 0 an error occured while sending.
+    */
+    int batchMessage(std::unique_ptr<TCPMessage> msg);
+
+    /**
+    * Sends the pending batch, a single DataMessage as DATA message. Does nothing if there is no pending batch.
+    * \return The number of bytes sent, 1 if there was no pending batch. If <= 0 an error occured while sending.
+    */
+    int flushBatch();
   };
 
 } // namespace tcp_io_device
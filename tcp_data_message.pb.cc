@@ -41,8 +41,17 @@ struct TCPMessageDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TCPMessageDefaultTypeInternal _TCPMessage_default_instance_;
 PROTOBUF_CONSTEXPR StartMessage::StartMessage(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.diagnosticmode_)*/false
-  , /*decltype(_impl_.reconnectiontype_)*/0
+    /*decltype(_impl_.reconnectiontype_)*/0
+  , /*decltype(_impl_.byteorder_)*/0
+  , /*decltype(_impl_.diagnosticmode_)*/false
+  , /*decltype(_impl_.timeseriescodec_)*/false
+  , /*decltype(_impl_.framedelta_)*/false
+  , /*decltype(_impl_.frameheader_)*/false
+  , /*decltype(_impl_.compression_)*/0
+  , /*decltype(_impl_.compressionthreshold_)*/uint64_t{0u}
+  , /*decltype(_impl_.framing_)*/0
+  , /*decltype(_impl_.maxbatchsize_)*/0u
+  , /*decltype(_impl_.maxbatchlatencyus_)*/uint64_t{0u}
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct StartMessageDefaultTypeInternal {
   PROTOBUF_CONSTEXPR StartMessageDefaultTypeInternal()
@@ -103,6 +112,9 @@ PROTOBUF_CONSTEXPR SetupMessage::SetupMessage(
   , /*decltype(_impl_.objects_)*/{::_pbi::ConstantInitialized()}
   , /*decltype(_impl_.commands_)*/{::_pbi::ConstantInitialized()}
   , /*decltype(_impl_.commanddescriptions_)*/{}
+  , /*decltype(_impl_.supportedcompressions_)*/{}
+  , /*decltype(_impl_._supportedcompressions_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.byteorder_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct SetupMessageDefaultTypeInternal {
   PROTOBUF_CONSTEXPR SetupMessageDefaultTypeInternal()
@@ -141,6 +153,54 @@ struct DataMessageDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DataMessageDefaultTypeInternal _DataMessage_default_instance_;
+PROTOBUF_CONSTEXPR BatchMessage::BatchMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.datamessages_)*/{}
+  , /*decltype(_impl_.timestamps_)*/{}
+  , /*decltype(_impl_._timestamps_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchMessageDefaultTypeInternal() {}
+  union {
+    BatchMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchMessageDefaultTypeInternal _BatchMessage_default_instance_;
+PROTOBUF_CONSTEXPR SubscriptionMessage::SubscriptionMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.subscriptions_)*/{}
+  , /*decltype(_impl_.includeothers_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SubscriptionMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubscriptionMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubscriptionMessageDefaultTypeInternal() {}
+  union {
+    SubscriptionMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubscriptionMessageDefaultTypeInternal _SubscriptionMessage_default_instance_;
+PROTOBUF_CONSTEXPR Subscription::Subscription(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entityid_)*/0
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.mininterval_)*/uint64_t{0u}
+  , /*decltype(_impl_.decimation_)*/0u
+  , /*decltype(_impl_.changeonly_)*/false
+  , /*decltype(_impl_.deadband_)*/0
+  , /*decltype(_impl_.maxinterval_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SubscriptionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubscriptionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubscriptionDefaultTypeInternal() {}
+  union {
+    Subscription _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubscriptionDefaultTypeInternal _Subscription_default_instance_;
 PROTOBUF_CONSTEXPR VariableDescription::VariableDescription(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.dimensions_)*/{}
@@ -149,6 +209,9 @@ PROTOBUF_CONSTEXPR VariableDescription::VariableDescription(
   , /*decltype(_impl_.entityid_)*/0
   , /*decltype(_impl_.id_)*/0
   , /*decltype(_impl_.datatype_)*/0
+  , /*decltype(_impl_.encoding_)*/0
+  , /*decltype(_impl_.scale_)*/0
+  , /*decltype(_impl_.offset_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct VariableDescriptionDefaultTypeInternal {
   PROTOBUF_CONSTEXPR VariableDescriptionDefaultTypeInternal()
@@ -161,7 +224,23 @@ struct VariableDescriptionDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VariableDescriptionDefaultTypeInternal _VariableDescription_default_instance_;
 PROTOBUF_CONSTEXPR ProtoVariable::ProtoVariable(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+    /*decltype(_impl_.doubledata_)*/{}
+  , /*decltype(_impl_.int64data_)*/{}
+  , /*decltype(_impl_._int64data_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.booldata_)*/{}
+  , /*decltype(_impl_.floatdata_)*/{}
+  , /*decltype(_impl_.int32data_)*/{}
+  , /*decltype(_impl_._int32data_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.uint32data_)*/{}
+  , /*decltype(_impl_._uint32data_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.uint64data_)*/{}
+  , /*decltype(_impl_._uint64data_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.sparseindices_)*/{}
+  , /*decltype(_impl_._sparseindices_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.deltaranges_)*/{}
+  , /*decltype(_impl_._deltaranges_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sparsebitmap_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.metadata_)*/nullptr
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct ProtoVariableDefaultTypeInternal {
@@ -174,8 +253,8 @@ struct ProtoVariableDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ProtoVariableDefaultTypeInternal _ProtoVariable_default_instance_;
 }  // namespace tcp_io_device
-static ::_pb::Metadata file_level_metadata_tcp_5fdata_5fmessage_2eproto[11];
-static const ::_pb::EnumDescriptor* file_level_enum_descriptors_tcp_5fdata_5fmessage_2eproto[3];
+static ::_pb::Metadata file_level_metadata_tcp_5fdata_5fmessage_2eproto[14];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_tcp_5fdata_5fmessage_2eproto[7];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_tcp_5fdata_5fmessage_2eproto = nullptr;
 
 const uint32_t TableStruct_tcp_5fdata_5fmessage_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -190,6 +269,8 @@ const uint32_t TableStruct_tcp_5fdata_5fmessage_2eproto::offsets[] PROTOBUF_SECT
   ::_pbi::kInvalidFieldOffsetTag,
   ::_pbi::kInvalidFieldOffsetTag,
   ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
   PROTOBUF_FIELD_OFFSET(::tcp_io_device::TCPMessage, _impl_.timestamp_),
   PROTOBUF_FIELD_OFFSET(::tcp_io_device::TCPMessage, _impl_.message_),
   ~0u,  // no _has_bits_
@@ -200,6 +281,15 @@ const uint32_t TableStruct_tcp_5fdata_5fmessage_2eproto::offsets[] PROTOBUF_SECT
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::tcp_io_device::StartMessage, _impl_.diagnosticmode_),
   PROTOBUF_FIELD_OFFSET(::tcp_io_device::StartMessage, _impl_.reconnectiontype_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::StartMessage, _impl_.byteorder_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::StartMessage, _impl_.timeseriescodec_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::StartMessage, _impl_.framedelta_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::StartMessage, _impl_.compression_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::StartMessage, _impl_.compressionthreshold_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::StartMessage, _impl_.frameheader_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::StartMessage, _impl_.framing_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::StartMessage, _impl_.maxbatchsize_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::StartMessage, _impl_.maxbatchlatencyus_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::tcp_io_device::StopMessage, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -246,6 +336,8 @@ const uint32_t TableStruct_tcp_5fdata_5fmessage_2eproto::offsets[] PROTOBUF_SECT
   PROTOBUF_FIELD_OFFSET(::tcp_io_device::SetupMessage, _impl_.objects_),
   PROTOBUF_FIELD_OFFSET(::tcp_io_device::SetupMessage, _impl_.commands_),
   PROTOBUF_FIELD_OFFSET(::tcp_io_device::SetupMessage, _impl_.commanddescriptions_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::SetupMessage, _impl_.byteorder_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::SetupMessage, _impl_.supportedcompressions_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::tcp_io_device::CommandDescription, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -263,6 +355,35 @@ const uint32_t TableStruct_tcp_5fdata_5fmessage_2eproto::offsets[] PROTOBUF_SECT
   PROTOBUF_FIELD_OFFSET(::tcp_io_device::DataMessage, _impl_.variables_),
   PROTOBUF_FIELD_OFFSET(::tcp_io_device::DataMessage, _impl_.timespan_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::BatchMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::BatchMessage, _impl_.datamessages_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::BatchMessage, _impl_.timestamps_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::SubscriptionMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::SubscriptionMessage, _impl_.subscriptions_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::SubscriptionMessage, _impl_.includeothers_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::Subscription, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::Subscription, _impl_.entityid_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::Subscription, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::Subscription, _impl_.decimation_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::Subscription, _impl_.mininterval_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::Subscription, _impl_.changeonly_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::Subscription, _impl_.deadband_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::Subscription, _impl_.maxinterval_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::tcp_io_device::VariableDescription, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -273,6 +394,9 @@ const uint32_t TableStruct_tcp_5fdata_5fmessage_2eproto::offsets[] PROTOBUF_SECT
   PROTOBUF_FIELD_OFFSET(::tcp_io_device::VariableDescription, _impl_.datatype_),
   PROTOBUF_FIELD_OFFSET(::tcp_io_device::VariableDescription, _impl_.dimensions_),
   PROTOBUF_FIELD_OFFSET(::tcp_io_device::VariableDescription, _impl_.opcode_string_handle_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::VariableDescription, _impl_.encoding_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::VariableDescription, _impl_.scale_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::VariableDescription, _impl_.offset_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::tcp_io_device::ProtoVariable, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -281,19 +405,32 @@ const uint32_t TableStruct_tcp_5fdata_5fmessage_2eproto::offsets[] PROTOBUF_SECT
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::tcp_io_device::ProtoVariable, _impl_.metadata_),
   PROTOBUF_FIELD_OFFSET(::tcp_io_device::ProtoVariable, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::ProtoVariable, _impl_.doubledata_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::ProtoVariable, _impl_.int64data_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::ProtoVariable, _impl_.booldata_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::ProtoVariable, _impl_.floatdata_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::ProtoVariable, _impl_.int32data_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::ProtoVariable, _impl_.uint32data_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::ProtoVariable, _impl_.uint64data_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::ProtoVariable, _impl_.sparseindices_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::ProtoVariable, _impl_.sparsebitmap_),
+  PROTOBUF_FIELD_OFFSET(::tcp_io_device::ProtoVariable, _impl_.deltaranges_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::tcp_io_device::TCPMessage)},
-  { 13, -1, -1, sizeof(::tcp_io_device::StartMessage)},
-  { 21, -1, -1, sizeof(::tcp_io_device::StopMessage)},
-  { 27, 35, -1, sizeof(::tcp_io_device::SetupMessage_EntitiesEntry_DoNotUse)},
-  { 37, 45, -1, sizeof(::tcp_io_device::SetupMessage_ObjectsEntry_DoNotUse)},
-  { 47, 55, -1, sizeof(::tcp_io_device::SetupMessage_CommandsEntry_DoNotUse)},
-  { 57, -1, -1, sizeof(::tcp_io_device::SetupMessage)},
-  { 67, -1, -1, sizeof(::tcp_io_device::CommandDescription)},
-  { 75, -1, -1, sizeof(::tcp_io_device::DataMessage)},
-  { 83, -1, -1, sizeof(::tcp_io_device::VariableDescription)},
-  { 94, -1, -1, sizeof(::tcp_io_device::ProtoVariable)},
+  { 15, -1, -1, sizeof(::tcp_io_device::StartMessage)},
+  { 32, -1, -1, sizeof(::tcp_io_device::StopMessage)},
+  { 38, 46, -1, sizeof(::tcp_io_device::SetupMessage_EntitiesEntry_DoNotUse)},
+  { 48, 56, -1, sizeof(::tcp_io_device::SetupMessage_ObjectsEntry_DoNotUse)},
+  { 58, 66, -1, sizeof(::tcp_io_device::SetupMessage_CommandsEntry_DoNotUse)},
+  { 68, -1, -1, sizeof(::tcp_io_device::SetupMessage)},
+  { 80, -1, -1, sizeof(::tcp_io_device::CommandDescription)},
+  { 88, -1, -1, sizeof(::tcp_io_device::DataMessage)},
+  { 96, -1, -1, sizeof(::tcp_io_device::BatchMessage)},
+  { 104, -1, -1, sizeof(::tcp_io_device::SubscriptionMessage)},
+  { 112, -1, -1, sizeof(::tcp_io_device::Subscription)},
+  { 125, -1, -1, sizeof(::tcp_io_device::VariableDescription)},
+  { 139, -1, -1, sizeof(::tcp_io_device::ProtoVariable)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -306,56 +443,99 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::tcp_io_device::_SetupMessage_default_instance_._instance,
   &::tcp_io_device::_CommandDescription_default_instance_._instance,
   &::tcp_io_device::_DataMessage_default_instance_._instance,
+  &::tcp_io_device::_BatchMessage_default_instance_._instance,
+  &::tcp_io_device::_SubscriptionMessage_default_instance_._instance,
+  &::tcp_io_device::_Subscription_default_instance_._instance,
   &::tcp_io_device::_VariableDescription_default_instance_._instance,
   &::tcp_io_device::_ProtoVariable_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_tcp_5fdata_5fmessage_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\026tcp_data_message.proto\022\rtcp_io_device\""
-  "\360\002\n\nTCPMessage\0223\n\013messageType\030\001 \001(\0162\036.tc"
+  "\247\004\n\nTCPMessage\0223\n\013messageType\030\001 \001(\0162\036.tc"
   "p_io_device.TCPMessage.Type\0223\n\014setupMess"
   "age\030\002 \001(\0132\033.tcp_io_device.SetupMessageH\000"
   "\0221\n\013dataMessage\030\003 \001(\0132\032.tcp_io_device.Da"
   "taMessageH\000\0223\n\014startMessage\030\004 \001(\0132\033.tcp_"
   "io_device.StartMessageH\000\0221\n\013stopMessage\030"
-  "\005 \001(\0132\032.tcp_io_device.StopMessageH\000\022\021\n\tt"
-  "imestamp\030\006 \001(\004\"\?\n\004Type\022\t\n\005SETUP\020\000\022\010\n\004DAT"
-  "A\020\001\022\t\n\005START\020\002\022\010\n\004STOP\020\003\022\r\n\tRECONNECT\020\004B"
-  "\t\n\007message\"\247\001\n\014StartMessage\022\026\n\016diagnosti"
-  "cMode\030\001 \001(\010\022F\n\020reconnectionType\030\002 \001(\0162,."
-  "tcp_io_device.StartMessage.ReconnectionT"
-  "ype\"7\n\020ReconnectionType\022\013\n\007RE_INIT\020\000\022\014\n\010"
-  "RE_SETUP\020\001\022\010\n\004NONE\020\002\"\r\n\013StopMessage\"\225\003\n\014"
-  "SetupMessage\022;\n\010entities\030\001 \003(\0132).tcp_io_"
-  "device.SetupMessage.EntitiesEntry\0229\n\007obj"
-  "ects\030\002 \003(\0132(.tcp_io_device.SetupMessage."
-  "ObjectsEntry\022;\n\010commands\030\003 \003(\0132).tcp_io_"
-  "device.SetupMessage.CommandsEntry\022>\n\023com"
-  "mandDescriptions\030\004 \003(\0132!.tcp_io_device.C"
-  "ommandDescription\032/\n\rEntitiesEntry\022\013\n\003ke"
-  "y\030\001 \001(\t\022\r\n\005value\030\002 \001(\005:\0028\001\032.\n\014ObjectsEnt"
-  "ry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\005:\0028\001\032/\n\rCo"
-  "mmandsEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\005:"
-  "\0028\001\"[\n\022CommandDescription\0227\n\013description"
-  "\030\001 \001(\0132\".tcp_io_device.VariableDescripti"
-  "on\022\014\n\004name\030\002 \001(\t\"P\n\013DataMessage\022/\n\tvaria"
-  "bles\030\001 \003(\0132\034.tcp_io_device.ProtoVariable"
-  "\022\020\n\010timeSpan\030\002 \001(\004\"\376\001\n\023VariableDescripti"
-  "on\022\020\n\010entityID\030\001 \001(\005\022\n\n\002ID\030\002 \001(\005\022=\n\010data"
-  "Type\030\003 \001(\0162+.tcp_io_device.VariableDescr"
-  "iption.DataType\022\022\n\ndimensions\030\004 \003(\004\022\034\n\024o"
-  "pcode_string_handle\030\005 \001(\t\"X\n\010DataType\022\n\n"
-  "\006DOUBLE\020\000\022\t\n\005INT64\020\003\022\010\n\004BOOL\020\014\022\n\n\006STRING"
-  "\020\r\022\t\n\005BYTES\020\016\022\024\n\020COMMUNICATION_ID\020\017\"S\n\rP"
-  "rotoVariable\0224\n\010metaData\030\001 \001(\0132\".tcp_io_"
-  "device.VariableDescription\022\014\n\004data\030\002 \001(\014"
-  "b\006proto3"
+  "\005 \001(\0132\032.tcp_io_device.StopMessageH\000\0223\n\014b"
+  "atchMessage\030\007 \001(\0132\033.tcp_io_device.BatchM"
+  "essageH\000\022A\n\023subscriptionMessage\030\010 \001(\0132\"."
+  "tcp_io_device.SubscriptionMessageH\000\022\021\n\tt"
+  "imestamp\030\006 \001(\004\"\\\n\004Type\022\t\n\005SETUP\020\000\022\010\n\004DAT"
+  "A\020\001\022\t\n\005START\020\002\022\010\n\004STOP\020\003\022\r\n\tRECONNECT\020\004\022"
+  "\t\n\005BATCH\020\005\022\020\n\014SUBSCRIPTION\020\006\" \n\tByteOrde"
+  "r\022\n\n\006LITTLE\020\000\022\007\n\003BIG\020\001B\t\n\007message\"\316\004\n\014St"
+  "artMessage\022\026\n\016diagnosticMode\030\001 \001(\010\022F\n\020re"
+  "connectionType\030\002 \001(\0162,.tcp_io_device.Sta"
+  "rtMessage.ReconnectionType\0226\n\tbyteOrder\030"
+  "\003 \001(\0162#.tcp_io_device.TCPMessage.ByteOrd"
+  "er\022\027\n\017timeSeriesCodec\030\004 \001(\010\022\022\n\nframeDelt"
+  "a\030\005 \001(\010\022<\n\013compression\030\006 \001(\0162\'.tcp_io_de"
+  "vice.StartMessage.Compression\022\034\n\024compres"
+  "sionThreshold\030\007 \001(\004\022\023\n\013frameHeader\030\010 \001(\010"
+  "\0224\n\007framing\030\t \001(\0162#.tcp_io_device.StartM"
+  "essage.Framing\022\024\n\014maxBatchSize\030\n \001(\r\022\031\n\021"
+  "maxBatchLatencyUs\030\013 \001(\004\"7\n\020ReconnectionT"
+  "ype\022\013\n\007RE_INIT\020\000\022\014\n\010RE_SETUP\020\001\022\010\n\004NONE\020\002"
+  "\"4\n\013Compression\022\022\n\016NO_COMPRESSION\020\000\022\007\n\003L"
+  "Z4\020\001\022\010\n\004ZSTD\020\002\"2\n\007Framing\022\021\n\rLENGTH_PREF"
+  "IX\020\000\022\024\n\020VARINT_DELIMITED\020\001\"\r\n\013StopMessag"
+  "e\"\225\004\n\014SetupMessage\022;\n\010entities\030\001 \003(\0132).t"
+  "cp_io_device.SetupMessage.EntitiesEntry\022"
+  "9\n\007objects\030\002 \003(\0132(.tcp_io_device.SetupMe"
+  "ssage.ObjectsEntry\022;\n\010commands\030\003 \003(\0132).t"
+  "cp_io_device.SetupMessage.CommandsEntry\022"
+  ">\n\023commandDescriptions\030\004 \003(\0132!.tcp_io_de"
+  "vice.CommandDescription\0226\n\tbyteOrder\030\005 \001"
+  "(\0162#.tcp_io_device.TCPMessage.ByteOrder\022"
+  "F\n\025supportedCompressions\030\006 \003(\0162\'.tcp_io_"
+  "device.StartMessage.Compression\032/\n\rEntit"
+  "iesEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\005:\0028\001"
+  "\032.\n\014ObjectsEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002"
+  " \001(\005:\0028\001\032/\n\rCommandsEntry\022\013\n\003key\030\001 \001(\t\022\r"
+  "\n\005value\030\002 \001(\005:\0028\001\"[\n\022CommandDescription\022"
+  "7\n\013description\030\001 \001(\0132\".tcp_io_device.Var"
+  "iableDescription\022\014\n\004name\030\002 \001(\t\"P\n\013DataMe"
+  "ssage\022/\n\tvariables\030\001 \003(\0132\034.tcp_io_device"
+  ".ProtoVariable\022\020\n\010timeSpan\030\002 \001(\004\"T\n\014Batc"
+  "hMessage\0220\n\014dataMessages\030\001 \003(\0132\032.tcp_io_"
+  "device.DataMessage\022\022\n\ntimestamps\030\002 \003(\004\"`"
+  "\n\023SubscriptionMessage\0222\n\rsubscriptions\030\001"
+  " \003(\0132\033.tcp_io_device.Subscription\022\025\n\rinc"
+  "ludeOthers\030\002 \001(\010\"\220\001\n\014Subscription\022\020\n\010ent"
+  "ityID\030\001 \001(\005\022\n\n\002ID\030\002 \001(\005\022\022\n\ndecimation\030\003 "
+  "\001(\r\022\023\n\013minInterval\030\004 \001(\004\022\022\n\nchangeOnly\030\005"
+  " \001(\010\022\020\n\010deadBand\030\006 \001(\001\022\023\n\013maxInterval\030\007 "
+  "\001(\004\"\352\004\n\023VariableDescription\022\020\n\010entityID\030"
+  "\001 \001(\005\022\n\n\002ID\030\002 \001(\005\022=\n\010dataType\030\003 \001(\0162+.tc"
+  "p_io_device.VariableDescription.DataType"
+  "\022\022\n\ndimensions\030\004 \003(\004\022\034\n\024opcode_string_ha"
+  "ndle\030\005 \001(\t\022=\n\010encoding\030\006 \001(\0162+.tcp_io_de"
+  "vice.VariableDescription.Encoding\022\r\n\005sca"
+  "le\030\007 \001(\001\022\016\n\006offset\030\010 \001(\001\"\206\001\n\010DataType\022\n\n"
+  "\006DOUBLE\020\000\022\t\n\005FLOAT\020\001\022\t\n\005INT32\020\002\022\t\n\005INT64"
+  "\020\003\022\n\n\006UINT32\020\004\022\n\n\006UINT64\020\005\022\010\n\004BOOL\020\014\022\n\n\006"
+  "STRING\020\r\022\t\n\005BYTES\020\016\022\024\n\020COMMUNICATION_ID\020"
+  "\017\"\334\001\n\010Encoding\022\007\n\003RAW\020\000\022\n\n\006PACKED\020\001\022\013\n\007F"
+  "LOAT16\020\002\022\014\n\010BFLOAT16\020\003\022\017\n\013LINEAR_INT8\020\004\022"
+  "\020\n\014LINEAR_INT16\020\005\022\016\n\nBIT_PACKED\020\006\022\025\n\021SPA"
+  "RSE_COORDINATE\020\007\022\021\n\rSPARSE_BITMAP\020\010\022\013\n\007G"
+  "ORILLA\020\t\022\020\n\014DELTA_VARINT\020\n\022\020\n\014DELTA_RANG"
+  "ES\020\013\022\022\n\016DELTA_KEYFRAME\020\014\"\234\002\n\rProtoVariab"
+  "le\0224\n\010metaData\030\001 \001(\0132\".tcp_io_device.Var"
+  "iableDescription\022\014\n\004data\030\002 \001(\014\022\022\n\ndouble"
+  "Data\030\003 \003(\001\022\021\n\tint64Data\030\004 \003(\022\022\020\n\010boolDat"
+  "a\030\005 \003(\010\022\021\n\tfloatData\030\006 \003(\002\022\021\n\tint32Data\030"
+  "\007 \003(\021\022\022\n\nuint32Data\030\010 \003(\r\022\022\n\nuint64Data\030"
+  "\t \003(\004\022\025\n\rsparseIndices\030\n \003(\004\022\024\n\014sparseBi"
+  "tmap\030\013 \001(\014\022\023\n\013deltaRanges\030\014 \003(\004b\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_tcp_5fdata_5fmessage_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_tcp_5fdata_5fmessage_2eproto = {
-    false, false, 1528, descriptor_table_protodef_tcp_5fdata_5fmessage_2eproto,
+    false, false, 3159, descriptor_table_protodef_tcp_5fdata_5fmessage_2eproto,
     "tcp_data_message.proto",
-    &descriptor_table_tcp_5fdata_5fmessage_2eproto_once, nullptr, 0, 11,
+    &descriptor_table_tcp_5fdata_5fmessage_2eproto_once, nullptr, 0, 14,
     schemas, file_default_instances, TableStruct_tcp_5fdata_5fmessage_2eproto::offsets,
     file_level_metadata_tcp_5fdata_5fmessage_2eproto, file_level_enum_descriptors_tcp_5fdata_5fmessage_2eproto,
     file_level_service_descriptors_tcp_5fdata_5fmessage_2eproto,
@@ -378,6 +558,8 @@ bool TCPMessage_Type_IsValid(int value) {
     case 2:
     case 3:
     case 4:
+    case 5:
+    case 6:
       return true;
     default:
       return false;
@@ -390,14 +572,37 @@ constexpr TCPMessage_Type TCPMessage::DATA;
 constexpr TCPMessage_Type TCPMessage::START;
 constexpr TCPMessage_Type TCPMessage::STOP;
 constexpr TCPMessage_Type TCPMessage::RECONNECT;
+constexpr TCPMessage_Type TCPMessage::BATCH;
+constexpr TCPMessage_Type TCPMessage::SUBSCRIPTION;
 constexpr TCPMessage_Type TCPMessage::Type_MIN;
 constexpr TCPMessage_Type TCPMessage::Type_MAX;
 constexpr int TCPMessage::Type_ARRAYSIZE;
 #endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
-const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StartMessage_ReconnectionType_descriptor() {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TCPMessage_ByteOrder_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_tcp_5fdata_5fmessage_2eproto);
   return file_level_enum_descriptors_tcp_5fdata_5fmessage_2eproto[1];
 }
+bool TCPMessage_ByteOrder_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr TCPMessage_ByteOrder TCPMessage::LITTLE;
+constexpr TCPMessage_ByteOrder TCPMessage::BIG;
+constexpr TCPMessage_ByteOrder TCPMessage::ByteOrder_MIN;
+constexpr TCPMessage_ByteOrder TCPMessage::ByteOrder_MAX;
+constexpr int TCPMessage::ByteOrder_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StartMessage_ReconnectionType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_tcp_5fdata_5fmessage_2eproto);
+  return file_level_enum_descriptors_tcp_5fdata_5fmessage_2eproto[2];
+}
 bool StartMessage_ReconnectionType_IsValid(int value) {
   switch (value) {
     case 0:
@@ -417,14 +622,62 @@ constexpr StartMessage_ReconnectionType StartMessage::ReconnectionType_MIN;
 constexpr StartMessage_ReconnectionType StartMessage::ReconnectionType_MAX;
 constexpr int StartMessage::ReconnectionType_ARRAYSIZE;
 #endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StartMessage_Compression_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_tcp_5fdata_5fmessage_2eproto);
+  return file_level_enum_descriptors_tcp_5fdata_5fmessage_2eproto[3];
+}
+bool StartMessage_Compression_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr StartMessage_Compression StartMessage::NO_COMPRESSION;
+constexpr StartMessage_Compression StartMessage::LZ4;
+constexpr StartMessage_Compression StartMessage::ZSTD;
+constexpr StartMessage_Compression StartMessage::Compression_MIN;
+constexpr StartMessage_Compression StartMessage::Compression_MAX;
+constexpr int StartMessage::Compression_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StartMessage_Framing_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_tcp_5fdata_5fmessage_2eproto);
+  return file_level_enum_descriptors_tcp_5fdata_5fmessage_2eproto[4];
+}
+bool StartMessage_Framing_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr StartMessage_Framing StartMessage::LENGTH_PREFIX;
+constexpr StartMessage_Framing StartMessage::VARINT_DELIMITED;
+constexpr StartMessage_Framing StartMessage::Framing_MIN;
+constexpr StartMessage_Framing StartMessage::Framing_MAX;
+constexpr int StartMessage::Framing_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* VariableDescription_DataType_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_tcp_5fdata_5fmessage_2eproto);
-  return file_level_enum_descriptors_tcp_5fdata_5fmessage_2eproto[2];
+  return file_level_enum_descriptors_tcp_5fdata_5fmessage_2eproto[5];
 }
 bool VariableDescription_DataType_IsValid(int value) {
   switch (value) {
     case 0:
+    case 1:
+    case 2:
     case 3:
+    case 4:
+    case 5:
     case 12:
     case 13:
     case 14:
@@ -437,7 +690,11 @@ bool VariableDescription_DataType_IsValid(int value) {
 
 #if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 constexpr VariableDescription_DataType VariableDescription::DOUBLE;
+constexpr VariableDescription_DataType VariableDescription::FLOAT;
+constexpr VariableDescription_DataType VariableDescription::INT32;
 constexpr VariableDescription_DataType VariableDescription::INT64;
+constexpr VariableDescription_DataType VariableDescription::UINT32;
+constexpr VariableDescription_DataType VariableDescription::UINT64;
 constexpr VariableDescription_DataType VariableDescription::BOOL;
 constexpr VariableDescription_DataType VariableDescription::STRING;
 constexpr VariableDescription_DataType VariableDescription::BYTES;
@@ -446,6 +703,49 @@ constexpr VariableDescription_DataType VariableDescription::DataType_MIN;
 constexpr VariableDescription_DataType VariableDescription::DataType_MAX;
 constexpr int VariableDescription::DataType_ARRAYSIZE;
 #endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* VariableDescription_Encoding_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_tcp_5fdata_5fmessage_2eproto);
+  return file_level_enum_descriptors_tcp_5fdata_5fmessage_2eproto[6];
+}
+bool VariableDescription_Encoding_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr VariableDescription_Encoding VariableDescription::RAW;
+constexpr VariableDescription_Encoding VariableDescription::PACKED;
+constexpr VariableDescription_Encoding VariableDescription::FLOAT16;
+constexpr VariableDescription_Encoding VariableDescription::BFLOAT16;
+constexpr VariableDescription_Encoding VariableDescription::LINEAR_INT8;
+constexpr VariableDescription_Encoding VariableDescription::LINEAR_INT16;
+constexpr VariableDescription_Encoding VariableDescription::BIT_PACKED;
+constexpr VariableDescription_Encoding VariableDescription::SPARSE_COORDINATE;
+constexpr VariableDescription_Encoding VariableDescription::SPARSE_BITMAP;
+constexpr VariableDescription_Encoding VariableDescription::GORILLA;
+constexpr VariableDescription_Encoding VariableDescription::DELTA_VARINT;
+constexpr VariableDescription_Encoding VariableDescription::DELTA_RANGES;
+constexpr VariableDescription_Encoding VariableDescription::DELTA_KEYFRAME;
+constexpr VariableDescription_Encoding VariableDescription::Encoding_MIN;
+constexpr VariableDescription_Encoding VariableDescription::Encoding_MAX;
+constexpr int VariableDescription::Encoding_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
 // ===================================================================
 
@@ -455,6 +755,8 @@ class TCPMessage::_Internal {
   static const ::tcp_io_device::DataMessage& datamessage(const TCPMessage* msg);
   static const ::tcp_io_device::StartMessage& startmessage(const TCPMessage* msg);
   static const ::tcp_io_device::StopMessage& stopmessage(const TCPMessage* msg);
+  static const ::tcp_io_device::BatchMessage& batchmessage(const TCPMessage* msg);
+  static const ::tcp_io_device::SubscriptionMessage& subscriptionmessage(const TCPMessage* msg);
 };
 
 const ::tcp_io_device::SetupMessage&
@@ -473,6 +775,14 @@ const ::tcp_io_device::StopMessage&
 TCPMessage::_Internal::stopmessage(const TCPMessage* msg) {
   return *msg->_impl_.message_.stopmessage_;
 }
+const ::tcp_io_device::BatchMessage&
+TCPMessage::_Internal::batchmessage(const TCPMessage* msg) {
+  return *msg->_impl_.message_.batchmessage_;
+}
+const ::tcp_io_device::SubscriptionMessage&
+TCPMessage::_Internal::subscriptionmessage(const TCPMessage* msg) {
+  return *msg->_impl_.message_.subscriptionmessage_;
+}
 void TCPMessage::set_allocated_setupmessage(::tcp_io_device::SetupMessage* setupmessage) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_message();
@@ -533,6 +843,36 @@ void TCPMessage::set_allocated_stopmessage(::tcp_io_device::StopMessage* stopmes
   }
   // @@protoc_insertion_point(field_set_allocated:tcp_io_device.TCPMessage.stopMessage)
 }
+void TCPMessage::set_allocated_batchmessage(::tcp_io_device::BatchMessage* batchmessage) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_message();
+  if (batchmessage) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(batchmessage);
+    if (message_arena != submessage_arena) {
+      batchmessage = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, batchmessage, submessage_arena);
+    }
+    set_has_batchmessage();
+    _impl_.message_.batchmessage_ = batchmessage;
+  }
+  // @@protoc_insertion_point(field_set_allocated:tcp_io_device.TCPMessage.batchMessage)
+}
+void TCPMessage::set_allocated_subscriptionmessage(::tcp_io_device::SubscriptionMessage* subscriptionmessage) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_message();
+  if (subscriptionmessage) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(subscriptionmessage);
+    if (message_arena != submessage_arena) {
+      subscriptionmessage = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, subscriptionmessage, submessage_arena);
+    }
+    set_has_subscriptionmessage();
+    _impl_.message_.subscriptionmessage_ = subscriptionmessage;
+  }
+  // @@protoc_insertion_point(field_set_allocated:tcp_io_device.TCPMessage.subscriptionMessage)
+}
 TCPMessage::TCPMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -575,6 +915,16 @@ TCPMessage::TCPMessage(const TCPMessage& from)
           from._internal_stopmessage());
       break;
     }
+    case kBatchMessage: {
+      _this->_internal_mutable_batchmessage()->::tcp_io_device::BatchMessage::MergeFrom(
+          from._internal_batchmessage());
+      break;
+    }
+    case kSubscriptionMessage: {
+      _this->_internal_mutable_subscriptionmessage()->::tcp_io_device::SubscriptionMessage::MergeFrom(
+          from._internal_subscriptionmessage());
+      break;
+    }
     case MESSAGE_NOT_SET: {
       break;
     }
@@ -643,6 +993,18 @@ void TCPMessage::clear_message() {
       }
       break;
     }
+    case kBatchMessage: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.message_.batchmessage_;
+      }
+      break;
+    }
+    case kSubscriptionMessage: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.message_.subscriptionmessage_;
+      }
+      break;
+    }
     case MESSAGE_NOT_SET: {
       break;
     }
@@ -719,6 +1081,22 @@ const char* TCPMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ct
         } else
           goto handle_unusual;
         continue;
+      // .tcp_io_device.BatchMessage batchMessage = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_batchmessage(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .tcp_io_device.SubscriptionMessage subscriptionMessage = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_subscriptionmessage(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -789,6 +1167,20 @@ uint8_t* TCPMessage::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_timestamp(), target);
   }
 
+  // .tcp_io_device.BatchMessage batchMessage = 7;
+  if (_internal_has_batchmessage()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::batchmessage(this),
+        _Internal::batchmessage(this).GetCachedSize(), target, stream);
+  }
+
+  // .tcp_io_device.SubscriptionMessage subscriptionMessage = 8;
+  if (_internal_has_subscriptionmessage()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::subscriptionmessage(this),
+        _Internal::subscriptionmessage(this).GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -845,6 +1237,20 @@ size_t TCPMessage::ByteSizeLong() const {
           *_impl_.message_.stopmessage_);
       break;
     }
+    // .tcp_io_device.BatchMessage batchMessage = 7;
+    case kBatchMessage: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.message_.batchmessage_);
+      break;
+    }
+    // .tcp_io_device.SubscriptionMessage subscriptionMessage = 8;
+    case kSubscriptionMessage: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.message_.subscriptionmessage_);
+      break;
+    }
     case MESSAGE_NOT_SET: {
       break;
     }
@@ -894,6 +1300,16 @@ void TCPMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PRO
           from._internal_stopmessage());
       break;
     }
+    case kBatchMessage: {
+      _this->_internal_mutable_batchmessage()->::tcp_io_device::BatchMessage::MergeFrom(
+          from._internal_batchmessage());
+      break;
+    }
+    case kSubscriptionMessage: {
+      _this->_internal_mutable_subscriptionmessage()->::tcp_io_device::SubscriptionMessage::MergeFrom(
+          from._internal_subscriptionmessage());
+      break;
+    }
     case MESSAGE_NOT_SET: {
       break;
     }
@@ -947,14 +1363,23 @@ StartMessage::StartMessage(const StartMessage& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   StartMessage* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.diagnosticmode_){}
-    , decltype(_impl_.reconnectiontype_){}
+      decltype(_impl_.reconnectiontype_){}
+    , decltype(_impl_.byteorder_){}
+    , decltype(_impl_.diagnosticmode_){}
+    , decltype(_impl_.timeseriescodec_){}
+    , decltype(_impl_.framedelta_){}
+    , decltype(_impl_.frameheader_){}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.compressionthreshold_){}
+    , decltype(_impl_.framing_){}
+    , decltype(_impl_.maxbatchsize_){}
+    , decltype(_impl_.maxbatchlatencyus_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&_impl_.diagnosticmode_, &from._impl_.diagnosticmode_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.reconnectiontype_) -
-    reinterpret_cast<char*>(&_impl_.diagnosticmode_)) + sizeof(_impl_.reconnectiontype_));
+  ::memcpy(&_impl_.reconnectiontype_, &from._impl_.reconnectiontype_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.maxbatchlatencyus_) -
+    reinterpret_cast<char*>(&_impl_.reconnectiontype_)) + sizeof(_impl_.maxbatchlatencyus_));
   // @@protoc_insertion_point(copy_constructor:tcp_io_device.StartMessage)
 }
 
@@ -963,8 +1388,17 @@ inline void StartMessage::SharedCtor(
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.diagnosticmode_){false}
-    , decltype(_impl_.reconnectiontype_){0}
+      decltype(_impl_.reconnectiontype_){0}
+    , decltype(_impl_.byteorder_){0}
+    , decltype(_impl_.diagnosticmode_){false}
+    , decltype(_impl_.timeseriescodec_){false}
+    , decltype(_impl_.framedelta_){false}
+    , decltype(_impl_.frameheader_){false}
+    , decltype(_impl_.compression_){0}
+    , decltype(_impl_.compressionthreshold_){uint64_t{0u}}
+    , decltype(_impl_.framing_){0}
+    , decltype(_impl_.maxbatchsize_){0u}
+    , decltype(_impl_.maxbatchlatencyus_){uint64_t{0u}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -992,9 +1426,9 @@ void StartMessage::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.diagnosticmode_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.reconnectiontype_) -
-      reinterpret_cast<char*>(&_impl_.diagnosticmode_)) + sizeof(_impl_.reconnectiontype_));
+  ::memset(&_impl_.reconnectiontype_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.maxbatchlatencyus_) -
+      reinterpret_cast<char*>(&_impl_.reconnectiontype_)) + sizeof(_impl_.maxbatchlatencyus_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1021,6 +1455,81 @@ const char* StartMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext*
         } else
           goto handle_unusual;
         continue;
+      // .tcp_io_device.TCPMessage.ByteOrder byteOrder = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_byteorder(static_cast<::tcp_io_device::TCPMessage_ByteOrder>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool timeSeriesCodec = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.timeseriescodec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool frameDelta = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.framedelta_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .tcp_io_device.StartMessage.Compression compression = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_compression(static_cast<::tcp_io_device::StartMessage_Compression>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 compressionThreshold = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.compressionthreshold_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool frameHeader = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.frameheader_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .tcp_io_device.StartMessage.Framing framing = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_framing(static_cast<::tcp_io_device::StartMessage_Framing>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 maxBatchSize = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.maxbatchsize_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 maxBatchLatencyUs = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.maxbatchlatencyus_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1063,6 +1572,63 @@ uint8_t* StartMessage::_InternalSerialize(
       2, this->_internal_reconnectiontype(), target);
   }
 
+  // .tcp_io_device.TCPMessage.ByteOrder byteOrder = 3;
+  if (this->_internal_byteorder() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_byteorder(), target);
+  }
+
+  // bool timeSeriesCodec = 4;
+  if (this->_internal_timeseriescodec() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_timeseriescodec(), target);
+  }
+
+  // bool frameDelta = 5;
+  if (this->_internal_framedelta() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_framedelta(), target);
+  }
+
+  // .tcp_io_device.StartMessage.Compression compression = 6;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      6, this->_internal_compression(), target);
+  }
+
+  // uint64 compressionThreshold = 7;
+  if (this->_internal_compressionthreshold() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_compressionthreshold(), target);
+  }
+
+  // bool frameHeader = 8;
+  if (this->_internal_frameheader() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_frameheader(), target);
+  }
+
+  // .tcp_io_device.StartMessage.Framing framing = 9;
+  if (this->_internal_framing() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      9, this->_internal_framing(), target);
+  }
+
+  // uint32 maxBatchSize = 10;
+  if (this->_internal_maxbatchsize() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_maxbatchsize(), target);
+  }
+
+  // uint64 maxBatchLatencyUs = 11;
+  if (this->_internal_maxbatchlatencyus() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(11, this->_internal_maxbatchlatencyus(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1079,25 +1645,73 @@ size_t StartMessage::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // .tcp_io_device.StartMessage.ReconnectionType reconnectionType = 2;
+  if (this->_internal_reconnectiontype() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_reconnectiontype());
+  }
+
+  // .tcp_io_device.TCPMessage.ByteOrder byteOrder = 3;
+  if (this->_internal_byteorder() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_byteorder());
+  }
+
   // bool diagnosticMode = 1;
   if (this->_internal_diagnosticmode() != 0) {
     total_size += 1 + 1;
   }
 
-  // .tcp_io_device.StartMessage.ReconnectionType reconnectionType = 2;
-  if (this->_internal_reconnectiontype() != 0) {
-    total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_reconnectiontype());
+  // bool timeSeriesCodec = 4;
+  if (this->_internal_timeseriescodec() != 0) {
+    total_size += 1 + 1;
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
-}
+  // bool frameDelta = 5;
+  if (this->_internal_framedelta() != 0) {
+    total_size += 1 + 1;
+  }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StartMessage::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    StartMessage::MergeImpl
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StartMessage::GetClassData() const { return &_class_data_; }
+  // bool frameHeader = 8;
+  if (this->_internal_frameheader() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // .tcp_io_device.StartMessage.Compression compression = 6;
+  if (this->_internal_compression() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_compression());
+  }
+
+  // uint64 compressionThreshold = 7;
+  if (this->_internal_compressionthreshold() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_compressionthreshold());
+  }
+
+  // .tcp_io_device.StartMessage.Framing framing = 9;
+  if (this->_internal_framing() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_framing());
+  }
+
+  // uint32 maxBatchSize = 10;
+  if (this->_internal_maxbatchsize() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_maxbatchsize());
+  }
+
+  // uint64 maxBatchLatencyUs = 11;
+  if (this->_internal_maxbatchlatencyus() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_maxbatchlatencyus());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StartMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StartMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StartMessage::GetClassData() const { return &_class_data_; }
 
 
 void StartMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
@@ -1108,11 +1722,38 @@ void StartMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::P
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (from._internal_reconnectiontype() != 0) {
+    _this->_internal_set_reconnectiontype(from._internal_reconnectiontype());
+  }
+  if (from._internal_byteorder() != 0) {
+    _this->_internal_set_byteorder(from._internal_byteorder());
+  }
   if (from._internal_diagnosticmode() != 0) {
     _this->_internal_set_diagnosticmode(from._internal_diagnosticmode());
   }
-  if (from._internal_reconnectiontype() != 0) {
-    _this->_internal_set_reconnectiontype(from._internal_reconnectiontype());
+  if (from._internal_timeseriescodec() != 0) {
+    _this->_internal_set_timeseriescodec(from._internal_timeseriescodec());
+  }
+  if (from._internal_framedelta() != 0) {
+    _this->_internal_set_framedelta(from._internal_framedelta());
+  }
+  if (from._internal_frameheader() != 0) {
+    _this->_internal_set_frameheader(from._internal_frameheader());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
+  }
+  if (from._internal_compressionthreshold() != 0) {
+    _this->_internal_set_compressionthreshold(from._internal_compressionthreshold());
+  }
+  if (from._internal_framing() != 0) {
+    _this->_internal_set_framing(from._internal_framing());
+  }
+  if (from._internal_maxbatchsize() != 0) {
+    _this->_internal_set_maxbatchsize(from._internal_maxbatchsize());
+  }
+  if (from._internal_maxbatchlatencyus() != 0) {
+    _this->_internal_set_maxbatchlatencyus(from._internal_maxbatchlatencyus());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
@@ -1132,11 +1773,11 @@ void StartMessage::InternalSwap(StartMessage* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(StartMessage, _impl_.reconnectiontype_)
-      + sizeof(StartMessage::_impl_.reconnectiontype_)
-      - PROTOBUF_FIELD_OFFSET(StartMessage, _impl_.diagnosticmode_)>(
-          reinterpret_cast<char*>(&_impl_.diagnosticmode_),
-          reinterpret_cast<char*>(&other->_impl_.diagnosticmode_));
+      PROTOBUF_FIELD_OFFSET(StartMessage, _impl_.maxbatchlatencyus_)
+      + sizeof(StartMessage::_impl_.maxbatchlatencyus_)
+      - PROTOBUF_FIELD_OFFSET(StartMessage, _impl_.reconnectiontype_)>(
+          reinterpret_cast<char*>(&_impl_.reconnectiontype_),
+          reinterpret_cast<char*>(&other->_impl_.reconnectiontype_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata StartMessage::GetMetadata() const {
@@ -1250,12 +1891,16 @@ SetupMessage::SetupMessage(const SetupMessage& from)
     , /*decltype(_impl_.objects_)*/{}
     , /*decltype(_impl_.commands_)*/{}
     , decltype(_impl_.commanddescriptions_){from._impl_.commanddescriptions_}
+    , decltype(_impl_.supportedcompressions_){from._impl_.supportedcompressions_}
+    , /*decltype(_impl_._supportedcompressions_cached_byte_size_)*/{0}
+    , decltype(_impl_.byteorder_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _this->_impl_.entities_.MergeFrom(from._impl_.entities_);
   _this->_impl_.objects_.MergeFrom(from._impl_.objects_);
   _this->_impl_.commands_.MergeFrom(from._impl_.commands_);
+  _this->_impl_.byteorder_ = from._impl_.byteorder_;
   // @@protoc_insertion_point(copy_constructor:tcp_io_device.SetupMessage)
 }
 
@@ -1268,6 +1913,9 @@ inline void SetupMessage::SharedCtor(
     , /*decltype(_impl_.objects_)*/{::_pbi::ArenaInitialized(), arena}
     , /*decltype(_impl_.commands_)*/{::_pbi::ArenaInitialized(), arena}
     , decltype(_impl_.commanddescriptions_){arena}
+    , decltype(_impl_.supportedcompressions_){arena}
+    , /*decltype(_impl_._supportedcompressions_cached_byte_size_)*/{0}
+    , decltype(_impl_.byteorder_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -1291,6 +1939,7 @@ inline void SetupMessage::SharedDtor() {
   _impl_.commands_.Destruct();
   _impl_.commands_.~MapField();
   _impl_.commanddescriptions_.~RepeatedPtrField();
+  _impl_.supportedcompressions_.~RepeatedField();
 }
 
 void SetupMessage::ArenaDtor(void* object) {
@@ -1313,6 +1962,8 @@ void SetupMessage::Clear() {
   _impl_.objects_.Clear();
   _impl_.commands_.Clear();
   _impl_.commanddescriptions_.Clear();
+  _impl_.supportedcompressions_.Clear();
+  _impl_.byteorder_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1374,6 +2025,27 @@ const char* SetupMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext*
         } else
           goto handle_unusual;
         continue;
+      // .tcp_io_device.TCPMessage.ByteOrder byteOrder = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_byteorder(static_cast<::tcp_io_device::TCPMessage_ByteOrder>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .tcp_io_device.StartMessage.Compression supportedCompressions = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser(_internal_mutable_supportedcompressions(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_add_supportedcompressions(static_cast<::tcp_io_device::StartMessage_Compression>(val));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1489,6 +2161,22 @@ uint8_t* SetupMessage::_InternalSerialize(
         InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
   }
 
+  // .tcp_io_device.TCPMessage.ByteOrder byteOrder = 5;
+  if (this->_internal_byteorder() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      5, this->_internal_byteorder(), target);
+  }
+
+  // repeated .tcp_io_device.StartMessage.Compression supportedCompressions = 6;
+  {
+    int byte_size = _impl_._supportedcompressions_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteEnumPacked(
+          6, _impl_.supportedcompressions_, byte_size, target);
+    }
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1539,6 +2227,29 @@ size_t SetupMessage::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  // repeated .tcp_io_device.StartMessage.Compression supportedCompressions = 6;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->_internal_supportedcompressions_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+        this->_internal_supportedcompressions(static_cast<int>(i)));
+    }
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._supportedcompressions_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // .tcp_io_device.TCPMessage.ByteOrder byteOrder = 5;
+  if (this->_internal_byteorder() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_byteorder());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1561,6 +2272,10 @@ void SetupMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::P
   _this->_impl_.objects_.MergeFrom(from._impl_.objects_);
   _this->_impl_.commands_.MergeFrom(from._impl_.commands_);
   _this->_impl_.commanddescriptions_.MergeFrom(from._impl_.commanddescriptions_);
+  _this->_impl_.supportedcompressions_.MergeFrom(from._impl_.supportedcompressions_);
+  if (from._internal_byteorder() != 0) {
+    _this->_internal_set_byteorder(from._internal_byteorder());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1582,6 +2297,8 @@ void SetupMessage::InternalSwap(SetupMessage* other) {
   _impl_.objects_.InternalSwap(&other->_impl_.objects_);
   _impl_.commands_.InternalSwap(&other->_impl_.commands_);
   _impl_.commanddescriptions_.InternalSwap(&other->_impl_.commanddescriptions_);
+  _impl_.supportedcompressions_.InternalSwap(&other->_impl_.supportedcompressions_);
+  swap(_impl_.byteorder_, other->_impl_.byteorder_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata SetupMessage::GetMetadata() const {
@@ -2049,64 +2766,43 @@ void DataMessage::InternalSwap(DataMessage* other) {
 
 // ===================================================================
 
-class VariableDescription::_Internal {
+class BatchMessage::_Internal {
  public:
 };
 
-VariableDescription::VariableDescription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+BatchMessage::BatchMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:tcp_io_device.VariableDescription)
+  // @@protoc_insertion_point(arena_constructor:tcp_io_device.BatchMessage)
 }
-VariableDescription::VariableDescription(const VariableDescription& from)
+BatchMessage::BatchMessage(const BatchMessage& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  VariableDescription* const _this = this; (void)_this;
+  BatchMessage* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.dimensions_){from._impl_.dimensions_}
-    , /*decltype(_impl_._dimensions_cached_byte_size_)*/{0}
-    , decltype(_impl_.opcode_string_handle_){}
-    , decltype(_impl_.entityid_){}
-    , decltype(_impl_.id_){}
-    , decltype(_impl_.datatype_){}
+      decltype(_impl_.datamessages_){from._impl_.datamessages_}
+    , decltype(_impl_.timestamps_){from._impl_.timestamps_}
+    , /*decltype(_impl_._timestamps_cached_byte_size_)*/{0}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.opcode_string_handle_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.opcode_string_handle_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_opcode_string_handle().empty()) {
-    _this->_impl_.opcode_string_handle_.Set(from._internal_opcode_string_handle(), 
-      _this->GetArenaForAllocation());
-  }
-  ::memcpy(&_impl_.entityid_, &from._impl_.entityid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.datatype_) -
-    reinterpret_cast<char*>(&_impl_.entityid_)) + sizeof(_impl_.datatype_));
-  // @@protoc_insertion_point(copy_constructor:tcp_io_device.VariableDescription)
+  // @@protoc_insertion_point(copy_constructor:tcp_io_device.BatchMessage)
 }
 
-inline void VariableDescription::SharedCtor(
+inline void BatchMessage::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.dimensions_){arena}
-    , /*decltype(_impl_._dimensions_cached_byte_size_)*/{0}
-    , decltype(_impl_.opcode_string_handle_){}
-    , decltype(_impl_.entityid_){0}
-    , decltype(_impl_.id_){0}
-    , decltype(_impl_.datatype_){0}
+      decltype(_impl_.datamessages_){arena}
+    , decltype(_impl_.timestamps_){arena}
+    , /*decltype(_impl_._timestamps_cached_byte_size_)*/{0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.opcode_string_handle_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.opcode_string_handle_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-VariableDescription::~VariableDescription() {
-  // @@protoc_insertion_point(destructor:tcp_io_device.VariableDescription)
+BatchMessage::~BatchMessage() {
+  // @@protoc_insertion_point(destructor:tcp_io_device.BatchMessage)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2114,79 +2810,54 @@ VariableDescription::~VariableDescription() {
   SharedDtor();
 }
 
-inline void VariableDescription::SharedDtor() {
+inline void BatchMessage::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.dimensions_.~RepeatedField();
-  _impl_.opcode_string_handle_.Destroy();
+  _impl_.datamessages_.~RepeatedPtrField();
+  _impl_.timestamps_.~RepeatedField();
 }
 
-void VariableDescription::SetCachedSize(int size) const {
+void BatchMessage::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void VariableDescription::Clear() {
-// @@protoc_insertion_point(message_clear_start:tcp_io_device.VariableDescription)
+void BatchMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:tcp_io_device.BatchMessage)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.dimensions_.Clear();
-  _impl_.opcode_string_handle_.ClearToEmpty();
-  ::memset(&_impl_.entityid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.datatype_) -
-      reinterpret_cast<char*>(&_impl_.entityid_)) + sizeof(_impl_.datatype_));
+  _impl_.datamessages_.Clear();
+  _impl_.timestamps_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* VariableDescription::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* BatchMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 entityID = 1;
+      // repeated .tcp_io_device.DataMessage dataMessages = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.entityid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_datamessages(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // int32 ID = 2;
+      // repeated uint64 timestamps = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // .tcp_io_device.VariableDescription.DataType dataType = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-          _internal_set_datatype(static_cast<::tcp_io_device::VariableDescription_DataType>(val));
-        } else
-          goto handle_unusual;
-        continue;
-      // repeated uint64 dimensions = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_dimensions(), ptr, ctx);
-          CHK_(ptr);
-        } else if (static_cast<uint8_t>(tag) == 32) {
-          _internal_add_dimensions(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_timestamps(), ptr, ctx);
           CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // string opcode_string_handle = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
-          auto str = _internal_mutable_opcode_string_handle();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_timestamps(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "tcp_io_device.VariableDescription.opcode_string_handle"));
         } else
           goto handle_unusual;
         continue;
@@ -2213,161 +2884,1088 @@ failure:
 #undef CHK_
 }
 
-uint8_t* VariableDescription::_InternalSerialize(
+uint8_t* BatchMessage::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:tcp_io_device.VariableDescription)
+  // @@protoc_insertion_point(serialize_to_array_start:tcp_io_device.BatchMessage)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 entityID = 1;
-  if (this->_internal_entityid() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_entityid(), target);
-  }
-
-  // int32 ID = 2;
-  if (this->_internal_id() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_id(), target);
-  }
-
-  // .tcp_io_device.VariableDescription.DataType dataType = 3;
-  if (this->_internal_datatype() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      3, this->_internal_datatype(), target);
+  // repeated .tcp_io_device.DataMessage dataMessages = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_datamessages_size()); i < n; i++) {
+    const auto& repfield = this->_internal_datamessages(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // repeated uint64 dimensions = 4;
+  // repeated uint64 timestamps = 2;
   {
-    int byte_size = _impl_._dimensions_cached_byte_size_.load(std::memory_order_relaxed);
+    int byte_size = _impl_._timestamps_cached_byte_size_.load(std::memory_order_relaxed);
     if (byte_size > 0) {
       target = stream->WriteUInt64Packed(
-          4, _internal_dimensions(), byte_size, target);
+          2, _internal_timestamps(), byte_size, target);
     }
   }
 
-  // string opcode_string_handle = 5;
-  if (!this->_internal_opcode_string_handle().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_opcode_string_handle().data(), static_cast<int>(this->_internal_opcode_string_handle().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "tcp_io_device.VariableDescription.opcode_string_handle");
-    target = stream->WriteStringMaybeAliased(
-        5, this->_internal_opcode_string_handle(), target);
-  }
-
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:tcp_io_device.VariableDescription)
+  // @@protoc_insertion_point(serialize_to_array_end:tcp_io_device.BatchMessage)
   return target;
 }
 
-size_t VariableDescription::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:tcp_io_device.VariableDescription)
+size_t BatchMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tcp_io_device.BatchMessage)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated uint64 dimensions = 4;
+  // repeated .tcp_io_device.DataMessage dataMessages = 1;
+  total_size += 1UL * this->_internal_datamessages_size();
+  for (const auto& msg : this->_impl_.datamessages_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated uint64 timestamps = 2;
   {
     size_t data_size = ::_pbi::WireFormatLite::
-      UInt64Size(this->_impl_.dimensions_);
+      UInt64Size(this->_impl_.timestamps_);
     if (data_size > 0) {
       total_size += 1 +
         ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
     int cached_size = ::_pbi::ToCachedSize(data_size);
-    _impl_._dimensions_cached_byte_size_.store(cached_size,
+    _impl_._timestamps_cached_byte_size_.store(cached_size,
                                     std::memory_order_relaxed);
     total_size += data_size;
   }
 
-  // string opcode_string_handle = 5;
-  if (!this->_internal_opcode_string_handle().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_opcode_string_handle());
-  }
-
-  // int32 entityID = 1;
-  if (this->_internal_entityid() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_entityid());
-  }
-
-  // int32 ID = 2;
-  if (this->_internal_id() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
-  }
-
-  // .tcp_io_device.VariableDescription.DataType dataType = 3;
-  if (this->_internal_datatype() != 0) {
-    total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_datatype());
-  }
-
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData VariableDescription::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchMessage::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    VariableDescription::MergeImpl
+    BatchMessage::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*VariableDescription::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchMessage::GetClassData() const { return &_class_data_; }
 
 
-void VariableDescription::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<VariableDescription*>(&to_msg);
-  auto& from = static_cast<const VariableDescription&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:tcp_io_device.VariableDescription)
+void BatchMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchMessage*>(&to_msg);
+  auto& from = static_cast<const BatchMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tcp_io_device.BatchMessage)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.dimensions_.MergeFrom(from._impl_.dimensions_);
-  if (!from._internal_opcode_string_handle().empty()) {
-    _this->_internal_set_opcode_string_handle(from._internal_opcode_string_handle());
-  }
-  if (from._internal_entityid() != 0) {
-    _this->_internal_set_entityid(from._internal_entityid());
-  }
-  if (from._internal_id() != 0) {
-    _this->_internal_set_id(from._internal_id());
-  }
-  if (from._internal_datatype() != 0) {
-    _this->_internal_set_datatype(from._internal_datatype());
-  }
+  _this->_impl_.datamessages_.MergeFrom(from._impl_.datamessages_);
+  _this->_impl_.timestamps_.MergeFrom(from._impl_.timestamps_);
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void VariableDescription::CopyFrom(const VariableDescription& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:tcp_io_device.VariableDescription)
+void BatchMessage::CopyFrom(const BatchMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tcp_io_device.BatchMessage)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool VariableDescription::IsInitialized() const {
+bool BatchMessage::IsInitialized() const {
   return true;
 }
 
-void VariableDescription::InternalSwap(VariableDescription* other) {
+void BatchMessage::InternalSwap(BatchMessage* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.dimensions_.InternalSwap(&other->_impl_.dimensions_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.opcode_string_handle_, lhs_arena,
-      &other->_impl_.opcode_string_handle_, rhs_arena
-  );
+  _impl_.datamessages_.InternalSwap(&other->_impl_.datamessages_);
+  _impl_.timestamps_.InternalSwap(&other->_impl_.timestamps_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_tcp_5fdata_5fmessage_2eproto_getter, &descriptor_table_tcp_5fdata_5fmessage_2eproto_once,
+      file_level_metadata_tcp_5fdata_5fmessage_2eproto[9]);
+}
+
+// ===================================================================
+
+class SubscriptionMessage::_Internal {
+ public:
+};
+
+SubscriptionMessage::SubscriptionMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tcp_io_device.SubscriptionMessage)
+}
+SubscriptionMessage::SubscriptionMessage(const SubscriptionMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SubscriptionMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.subscriptions_){from._impl_.subscriptions_}
+    , decltype(_impl_.includeothers_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.includeothers_ = from._impl_.includeothers_;
+  // @@protoc_insertion_point(copy_constructor:tcp_io_device.SubscriptionMessage)
+}
+
+inline void SubscriptionMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.subscriptions_){arena}
+    , decltype(_impl_.includeothers_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SubscriptionMessage::~SubscriptionMessage() {
+  // @@protoc_insertion_point(destructor:tcp_io_device.SubscriptionMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubscriptionMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.subscriptions_.~RepeatedPtrField();
+}
+
+void SubscriptionMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SubscriptionMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:tcp_io_device.SubscriptionMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.subscriptions_.Clear();
+  _impl_.includeothers_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SubscriptionMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .tcp_io_device.Subscription subscriptions = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_subscriptions(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool includeOthers = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.includeothers_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubscriptionMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tcp_io_device.SubscriptionMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .tcp_io_device.Subscription subscriptions = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_subscriptions_size()); i < n; i++) {
+    const auto& repfield = this->_internal_subscriptions(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bool includeOthers = 2;
+  if (this->_internal_includeothers() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_includeothers(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tcp_io_device.SubscriptionMessage)
+  return target;
+}
+
+size_t SubscriptionMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tcp_io_device.SubscriptionMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .tcp_io_device.Subscription subscriptions = 1;
+  total_size += 1UL * this->_internal_subscriptions_size();
+  for (const auto& msg : this->_impl_.subscriptions_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bool includeOthers = 2;
+  if (this->_internal_includeothers() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SubscriptionMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SubscriptionMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SubscriptionMessage::GetClassData() const { return &_class_data_; }
+
+
+void SubscriptionMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SubscriptionMessage*>(&to_msg);
+  auto& from = static_cast<const SubscriptionMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tcp_io_device.SubscriptionMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.subscriptions_.MergeFrom(from._impl_.subscriptions_);
+  if (from._internal_includeothers() != 0) {
+    _this->_internal_set_includeothers(from._internal_includeothers());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SubscriptionMessage::CopyFrom(const SubscriptionMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tcp_io_device.SubscriptionMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubscriptionMessage::IsInitialized() const {
+  return true;
+}
+
+void SubscriptionMessage::InternalSwap(SubscriptionMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.subscriptions_.InternalSwap(&other->_impl_.subscriptions_);
+  swap(_impl_.includeothers_, other->_impl_.includeothers_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SubscriptionMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_tcp_5fdata_5fmessage_2eproto_getter, &descriptor_table_tcp_5fdata_5fmessage_2eproto_once,
+      file_level_metadata_tcp_5fdata_5fmessage_2eproto[10]);
+}
+
+// ===================================================================
+
+class Subscription::_Internal {
+ public:
+};
+
+Subscription::Subscription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tcp_io_device.Subscription)
+}
+Subscription::Subscription(const Subscription& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Subscription* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entityid_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.mininterval_){}
+    , decltype(_impl_.decimation_){}
+    , decltype(_impl_.changeonly_){}
+    , decltype(_impl_.deadband_){}
+    , decltype(_impl_.maxinterval_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.entityid_, &from._impl_.entityid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.maxinterval_) -
+    reinterpret_cast<char*>(&_impl_.entityid_)) + sizeof(_impl_.maxinterval_));
+  // @@protoc_insertion_point(copy_constructor:tcp_io_device.Subscription)
+}
+
+inline void Subscription::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entityid_){0}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.mininterval_){uint64_t{0u}}
+    , decltype(_impl_.decimation_){0u}
+    , decltype(_impl_.changeonly_){false}
+    , decltype(_impl_.deadband_){0}
+    , decltype(_impl_.maxinterval_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Subscription::~Subscription() {
+  // @@protoc_insertion_point(destructor:tcp_io_device.Subscription)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Subscription::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Subscription::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Subscription::Clear() {
+// @@protoc_insertion_point(message_clear_start:tcp_io_device.Subscription)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.entityid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.maxinterval_) -
+      reinterpret_cast<char*>(&_impl_.entityid_)) + sizeof(_impl_.maxinterval_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Subscription::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 entityID = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.entityid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 ID = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 decimation = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.decimation_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 minInterval = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.mininterval_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool changeOnly = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.changeonly_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double deadBand = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _impl_.deadband_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 maxInterval = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.maxinterval_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Subscription::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tcp_io_device.Subscription)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 entityID = 1;
+  if (this->_internal_entityid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_entityid(), target);
+  }
+
+  // int32 ID = 2;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_id(), target);
+  }
+
+  // uint32 decimation = 3;
+  if (this->_internal_decimation() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_decimation(), target);
+  }
+
+  // uint64 minInterval = 4;
+  if (this->_internal_mininterval() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_mininterval(), target);
+  }
+
+  // bool changeOnly = 5;
+  if (this->_internal_changeonly() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_changeonly(), target);
+  }
+
+  // double deadBand = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_deadband = this->_internal_deadband();
+  uint64_t raw_deadband;
+  memcpy(&raw_deadband, &tmp_deadband, sizeof(tmp_deadband));
+  if (raw_deadband != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_deadband(), target);
+  }
+
+  // uint64 maxInterval = 7;
+  if (this->_internal_maxinterval() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_maxinterval(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tcp_io_device.Subscription)
+  return target;
+}
+
+size_t Subscription::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tcp_io_device.Subscription)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 entityID = 1;
+  if (this->_internal_entityid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_entityid());
+  }
+
+  // int32 ID = 2;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
+  }
+
+  // uint64 minInterval = 4;
+  if (this->_internal_mininterval() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_mininterval());
+  }
+
+  // uint32 decimation = 3;
+  if (this->_internal_decimation() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_decimation());
+  }
+
+  // bool changeOnly = 5;
+  if (this->_internal_changeonly() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // double deadBand = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_deadband = this->_internal_deadband();
+  uint64_t raw_deadband;
+  memcpy(&raw_deadband, &tmp_deadband, sizeof(tmp_deadband));
+  if (raw_deadband != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 maxInterval = 7;
+  if (this->_internal_maxinterval() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_maxinterval());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Subscription::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Subscription::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Subscription::GetClassData() const { return &_class_data_; }
+
+
+void Subscription::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Subscription*>(&to_msg);
+  auto& from = static_cast<const Subscription&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tcp_io_device.Subscription)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_entityid() != 0) {
+    _this->_internal_set_entityid(from._internal_entityid());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_mininterval() != 0) {
+    _this->_internal_set_mininterval(from._internal_mininterval());
+  }
+  if (from._internal_decimation() != 0) {
+    _this->_internal_set_decimation(from._internal_decimation());
+  }
+  if (from._internal_changeonly() != 0) {
+    _this->_internal_set_changeonly(from._internal_changeonly());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_deadband = from._internal_deadband();
+  uint64_t raw_deadband;
+  memcpy(&raw_deadband, &tmp_deadband, sizeof(tmp_deadband));
+  if (raw_deadband != 0) {
+    _this->_internal_set_deadband(from._internal_deadband());
+  }
+  if (from._internal_maxinterval() != 0) {
+    _this->_internal_set_maxinterval(from._internal_maxinterval());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Subscription::CopyFrom(const Subscription& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tcp_io_device.Subscription)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Subscription::IsInitialized() const {
+  return true;
+}
+
+void Subscription::InternalSwap(Subscription* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Subscription, _impl_.maxinterval_)
+      + sizeof(Subscription::_impl_.maxinterval_)
+      - PROTOBUF_FIELD_OFFSET(Subscription, _impl_.entityid_)>(
+          reinterpret_cast<char*>(&_impl_.entityid_),
+          reinterpret_cast<char*>(&other->_impl_.entityid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Subscription::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_tcp_5fdata_5fmessage_2eproto_getter, &descriptor_table_tcp_5fdata_5fmessage_2eproto_once,
+      file_level_metadata_tcp_5fdata_5fmessage_2eproto[11]);
+}
+
+// ===================================================================
+
+class VariableDescription::_Internal {
+ public:
+};
+
+VariableDescription::VariableDescription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tcp_io_device.VariableDescription)
+}
+VariableDescription::VariableDescription(const VariableDescription& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  VariableDescription* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dimensions_){from._impl_.dimensions_}
+    , /*decltype(_impl_._dimensions_cached_byte_size_)*/{0}
+    , decltype(_impl_.opcode_string_handle_){}
+    , decltype(_impl_.entityid_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.datatype_){}
+    , decltype(_impl_.encoding_){}
+    , decltype(_impl_.scale_){}
+    , decltype(_impl_.offset_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.opcode_string_handle_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.opcode_string_handle_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_opcode_string_handle().empty()) {
+    _this->_impl_.opcode_string_handle_.Set(from._internal_opcode_string_handle(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.entityid_, &from._impl_.entityid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.offset_) -
+    reinterpret_cast<char*>(&_impl_.entityid_)) + sizeof(_impl_.offset_));
+  // @@protoc_insertion_point(copy_constructor:tcp_io_device.VariableDescription)
+}
+
+inline void VariableDescription::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dimensions_){arena}
+    , /*decltype(_impl_._dimensions_cached_byte_size_)*/{0}
+    , decltype(_impl_.opcode_string_handle_){}
+    , decltype(_impl_.entityid_){0}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.datatype_){0}
+    , decltype(_impl_.encoding_){0}
+    , decltype(_impl_.scale_){0}
+    , decltype(_impl_.offset_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.opcode_string_handle_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.opcode_string_handle_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+VariableDescription::~VariableDescription() {
+  // @@protoc_insertion_point(destructor:tcp_io_device.VariableDescription)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void VariableDescription::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.dimensions_.~RepeatedField();
+  _impl_.opcode_string_handle_.Destroy();
+}
+
+void VariableDescription::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void VariableDescription::Clear() {
+// @@protoc_insertion_point(message_clear_start:tcp_io_device.VariableDescription)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.dimensions_.Clear();
+  _impl_.opcode_string_handle_.ClearToEmpty();
+  ::memset(&_impl_.entityid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.offset_) -
+      reinterpret_cast<char*>(&_impl_.entityid_)) + sizeof(_impl_.offset_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* VariableDescription::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 entityID = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.entityid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 ID = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .tcp_io_device.VariableDescription.DataType dataType = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_datatype(static_cast<::tcp_io_device::VariableDescription_DataType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 dimensions = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_dimensions(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_dimensions(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string opcode_string_handle = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_opcode_string_handle();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tcp_io_device.VariableDescription.opcode_string_handle"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .tcp_io_device.VariableDescription.Encoding encoding = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_encoding(static_cast<::tcp_io_device::VariableDescription_Encoding>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // double scale = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _impl_.scale_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double offset = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* VariableDescription::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tcp_io_device.VariableDescription)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 entityID = 1;
+  if (this->_internal_entityid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_entityid(), target);
+  }
+
+  // int32 ID = 2;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_id(), target);
+  }
+
+  // .tcp_io_device.VariableDescription.DataType dataType = 3;
+  if (this->_internal_datatype() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_datatype(), target);
+  }
+
+  // repeated uint64 dimensions = 4;
+  {
+    int byte_size = _impl_._dimensions_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          4, _internal_dimensions(), byte_size, target);
+    }
+  }
+
+  // string opcode_string_handle = 5;
+  if (!this->_internal_opcode_string_handle().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_opcode_string_handle().data(), static_cast<int>(this->_internal_opcode_string_handle().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tcp_io_device.VariableDescription.opcode_string_handle");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_opcode_string_handle(), target);
+  }
+
+  // .tcp_io_device.VariableDescription.Encoding encoding = 6;
+  if (this->_internal_encoding() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      6, this->_internal_encoding(), target);
+  }
+
+  // double scale = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_scale = this->_internal_scale();
+  uint64_t raw_scale;
+  memcpy(&raw_scale, &tmp_scale, sizeof(tmp_scale));
+  if (raw_scale != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_scale(), target);
+  }
+
+  // double offset = 8;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_offset = this->_internal_offset();
+  uint64_t raw_offset;
+  memcpy(&raw_offset, &tmp_offset, sizeof(tmp_offset));
+  if (raw_offset != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_offset(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tcp_io_device.VariableDescription)
+  return target;
+}
+
+size_t VariableDescription::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tcp_io_device.VariableDescription)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 dimensions = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.dimensions_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._dimensions_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // string opcode_string_handle = 5;
+  if (!this->_internal_opcode_string_handle().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_opcode_string_handle());
+  }
+
+  // int32 entityID = 1;
+  if (this->_internal_entityid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_entityid());
+  }
+
+  // int32 ID = 2;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
+  }
+
+  // .tcp_io_device.VariableDescription.DataType dataType = 3;
+  if (this->_internal_datatype() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_datatype());
+  }
+
+  // .tcp_io_device.VariableDescription.Encoding encoding = 6;
+  if (this->_internal_encoding() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_encoding());
+  }
+
+  // double scale = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_scale = this->_internal_scale();
+  uint64_t raw_scale;
+  memcpy(&raw_scale, &tmp_scale, sizeof(tmp_scale));
+  if (raw_scale != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double offset = 8;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_offset = this->_internal_offset();
+  uint64_t raw_offset;
+  memcpy(&raw_offset, &tmp_offset, sizeof(tmp_offset));
+  if (raw_offset != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData VariableDescription::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    VariableDescription::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*VariableDescription::GetClassData() const { return &_class_data_; }
+
+
+void VariableDescription::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<VariableDescription*>(&to_msg);
+  auto& from = static_cast<const VariableDescription&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tcp_io_device.VariableDescription)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.dimensions_.MergeFrom(from._impl_.dimensions_);
+  if (!from._internal_opcode_string_handle().empty()) {
+    _this->_internal_set_opcode_string_handle(from._internal_opcode_string_handle());
+  }
+  if (from._internal_entityid() != 0) {
+    _this->_internal_set_entityid(from._internal_entityid());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_datatype() != 0) {
+    _this->_internal_set_datatype(from._internal_datatype());
+  }
+  if (from._internal_encoding() != 0) {
+    _this->_internal_set_encoding(from._internal_encoding());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_scale = from._internal_scale();
+  uint64_t raw_scale;
+  memcpy(&raw_scale, &tmp_scale, sizeof(tmp_scale));
+  if (raw_scale != 0) {
+    _this->_internal_set_scale(from._internal_scale());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_offset = from._internal_offset();
+  uint64_t raw_offset;
+  memcpy(&raw_offset, &tmp_offset, sizeof(tmp_offset));
+  if (raw_offset != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VariableDescription::CopyFrom(const VariableDescription& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tcp_io_device.VariableDescription)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool VariableDescription::IsInitialized() const {
+  return true;
+}
+
+void VariableDescription::InternalSwap(VariableDescription* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.dimensions_.InternalSwap(&other->_impl_.dimensions_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.opcode_string_handle_, lhs_arena,
+      &other->_impl_.opcode_string_handle_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(VariableDescription, _impl_.datatype_)
-      + sizeof(VariableDescription::_impl_.datatype_)
+      PROTOBUF_FIELD_OFFSET(VariableDescription, _impl_.offset_)
+      + sizeof(VariableDescription::_impl_.offset_)
       - PROTOBUF_FIELD_OFFSET(VariableDescription, _impl_.entityid_)>(
           reinterpret_cast<char*>(&_impl_.entityid_),
           reinterpret_cast<char*>(&other->_impl_.entityid_));
@@ -2376,7 +3974,7 @@ void VariableDescription::InternalSwap(VariableDescription* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata VariableDescription::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_tcp_5fdata_5fmessage_2eproto_getter, &descriptor_table_tcp_5fdata_5fmessage_2eproto_once,
-      file_level_metadata_tcp_5fdata_5fmessage_2eproto[9]);
+      file_level_metadata_tcp_5fdata_5fmessage_2eproto[12]);
 }
 
 // ===================================================================
@@ -2400,7 +3998,23 @@ ProtoVariable::ProtoVariable(const ProtoVariable& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   ProtoVariable* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.data_){}
+      decltype(_impl_.doubledata_){from._impl_.doubledata_}
+    , decltype(_impl_.int64data_){from._impl_.int64data_}
+    , /*decltype(_impl_._int64data_cached_byte_size_)*/{0}
+    , decltype(_impl_.booldata_){from._impl_.booldata_}
+    , decltype(_impl_.floatdata_){from._impl_.floatdata_}
+    , decltype(_impl_.int32data_){from._impl_.int32data_}
+    , /*decltype(_impl_._int32data_cached_byte_size_)*/{0}
+    , decltype(_impl_.uint32data_){from._impl_.uint32data_}
+    , /*decltype(_impl_._uint32data_cached_byte_size_)*/{0}
+    , decltype(_impl_.uint64data_){from._impl_.uint64data_}
+    , /*decltype(_impl_._uint64data_cached_byte_size_)*/{0}
+    , decltype(_impl_.sparseindices_){from._impl_.sparseindices_}
+    , /*decltype(_impl_._sparseindices_cached_byte_size_)*/{0}
+    , decltype(_impl_.deltaranges_){from._impl_.deltaranges_}
+    , /*decltype(_impl_._deltaranges_cached_byte_size_)*/{0}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.sparsebitmap_){}
     , decltype(_impl_.metadata_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}};
 
@@ -2413,6 +4027,14 @@ ProtoVariable::ProtoVariable(const ProtoVariable& from)
     _this->_impl_.data_.Set(from._internal_data(), 
       _this->GetArenaForAllocation());
   }
+  _impl_.sparsebitmap_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sparsebitmap_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_sparsebitmap().empty()) {
+    _this->_impl_.sparsebitmap_.Set(from._internal_sparsebitmap(), 
+      _this->GetArenaForAllocation());
+  }
   if (from._internal_has_metadata()) {
     _this->_impl_.metadata_ = new ::tcp_io_device::VariableDescription(*from._impl_.metadata_);
   }
@@ -2424,7 +4046,23 @@ inline void ProtoVariable::SharedCtor(
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.data_){}
+      decltype(_impl_.doubledata_){arena}
+    , decltype(_impl_.int64data_){arena}
+    , /*decltype(_impl_._int64data_cached_byte_size_)*/{0}
+    , decltype(_impl_.booldata_){arena}
+    , decltype(_impl_.floatdata_){arena}
+    , decltype(_impl_.int32data_){arena}
+    , /*decltype(_impl_._int32data_cached_byte_size_)*/{0}
+    , decltype(_impl_.uint32data_){arena}
+    , /*decltype(_impl_._uint32data_cached_byte_size_)*/{0}
+    , decltype(_impl_.uint64data_){arena}
+    , /*decltype(_impl_._uint64data_cached_byte_size_)*/{0}
+    , decltype(_impl_.sparseindices_){arena}
+    , /*decltype(_impl_._sparseindices_cached_byte_size_)*/{0}
+    , decltype(_impl_.deltaranges_){arena}
+    , /*decltype(_impl_._deltaranges_cached_byte_size_)*/{0}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.sparsebitmap_){}
     , decltype(_impl_.metadata_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}
   };
@@ -2432,6 +4070,10 @@ inline void ProtoVariable::SharedCtor(
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.data_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.sparsebitmap_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sparsebitmap_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 ProtoVariable::~ProtoVariable() {
@@ -2445,7 +4087,17 @@ ProtoVariable::~ProtoVariable() {
 
 inline void ProtoVariable::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.doubledata_.~RepeatedField();
+  _impl_.int64data_.~RepeatedField();
+  _impl_.booldata_.~RepeatedField();
+  _impl_.floatdata_.~RepeatedField();
+  _impl_.int32data_.~RepeatedField();
+  _impl_.uint32data_.~RepeatedField();
+  _impl_.uint64data_.~RepeatedField();
+  _impl_.sparseindices_.~RepeatedField();
+  _impl_.deltaranges_.~RepeatedField();
   _impl_.data_.Destroy();
+  _impl_.sparsebitmap_.Destroy();
   if (this != internal_default_instance()) delete _impl_.metadata_;
 }
 
@@ -2459,7 +4111,17 @@ void ProtoVariable::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  _impl_.doubledata_.Clear();
+  _impl_.int64data_.Clear();
+  _impl_.booldata_.Clear();
+  _impl_.floatdata_.Clear();
+  _impl_.int32data_.Clear();
+  _impl_.uint32data_.Clear();
+  _impl_.uint64data_.Clear();
+  _impl_.sparseindices_.Clear();
+  _impl_.deltaranges_.Clear();
   _impl_.data_.ClearToEmpty();
+  _impl_.sparsebitmap_.ClearToEmpty();
   if (GetArenaForAllocation() == nullptr && _impl_.metadata_ != nullptr) {
     delete _impl_.metadata_;
   }
@@ -2490,6 +4152,114 @@ const char* ProtoVariable::_InternalParse(const char* ptr, ::_pbi::ParseContext*
         } else
           goto handle_unusual;
         continue;
+      // repeated double doubleData = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_doubledata(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 25) {
+          _internal_add_doubledata(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint64 int64Data = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt64Parser(_internal_mutable_int64data(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_int64data(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bool boolData = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedBoolParser(_internal_mutable_booldata(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_booldata(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float floatData = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_floatdata(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 53) {
+          _internal_add_floatdata(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint32 int32Data = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(_internal_mutable_int32data(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 56) {
+          _internal_add_int32data(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 uint32Data = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_uint32data(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 64) {
+          _internal_add_uint32data(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 uint64Data = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_uint64data(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 72) {
+          _internal_add_uint64data(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 sparseIndices = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_sparseindices(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 80) {
+          _internal_add_sparseindices(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes sparseBitmap = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          auto str = _internal_mutable_sparsebitmap();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 deltaRanges = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_deltaranges(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 96) {
+          _internal_add_deltaranges(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -2532,6 +4302,81 @@ uint8_t* ProtoVariable::_InternalSerialize(
         2, this->_internal_data(), target);
   }
 
+  // repeated double doubleData = 3;
+  if (this->_internal_doubledata_size() > 0) {
+    target = stream->WriteFixedPacked(3, _internal_doubledata(), target);
+  }
+
+  // repeated sint64 int64Data = 4;
+  {
+    int byte_size = _impl_._int64data_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt64Packed(
+          4, _internal_int64data(), byte_size, target);
+    }
+  }
+
+  // repeated bool boolData = 5;
+  if (this->_internal_booldata_size() > 0) {
+    target = stream->WriteFixedPacked(5, _internal_booldata(), target);
+  }
+
+  // repeated float floatData = 6;
+  if (this->_internal_floatdata_size() > 0) {
+    target = stream->WriteFixedPacked(6, _internal_floatdata(), target);
+  }
+
+  // repeated sint32 int32Data = 7;
+  {
+    int byte_size = _impl_._int32data_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          7, _internal_int32data(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 uint32Data = 8;
+  {
+    int byte_size = _impl_._uint32data_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          8, _internal_uint32data(), byte_size, target);
+    }
+  }
+
+  // repeated uint64 uint64Data = 9;
+  {
+    int byte_size = _impl_._uint64data_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          9, _internal_uint64data(), byte_size, target);
+    }
+  }
+
+  // repeated uint64 sparseIndices = 10;
+  {
+    int byte_size = _impl_._sparseindices_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          10, _internal_sparseindices(), byte_size, target);
+    }
+  }
+
+  // bytes sparseBitmap = 11;
+  if (!this->_internal_sparsebitmap().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        11, this->_internal_sparsebitmap(), target);
+  }
+
+  // repeated uint64 deltaRanges = 12;
+  {
+    int byte_size = _impl_._deltaranges_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          12, _internal_deltaranges(), byte_size, target);
+    }
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -2548,6 +4393,123 @@ size_t ProtoVariable::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // repeated double doubleData = 3;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_doubledata_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated sint64 int64Data = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt64Size(this->_impl_.int64data_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._int64data_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated bool boolData = 5;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_booldata_size());
+    size_t data_size = 1UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated float floatData = 6;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_floatdata_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated sint32 int32Data = 7;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt32Size(this->_impl_.int32data_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._int32data_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 uint32Data = 8;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.uint32data_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._uint32data_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint64 uint64Data = 9;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.uint64data_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._uint64data_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint64 sparseIndices = 10;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.sparseindices_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._sparseindices_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint64 deltaRanges = 12;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.deltaranges_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._deltaranges_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
   // bytes data = 2;
   if (!this->_internal_data().empty()) {
     total_size += 1 +
@@ -2555,6 +4517,13 @@ size_t ProtoVariable::ByteSizeLong() const {
         this->_internal_data());
   }
 
+  // bytes sparseBitmap = 11;
+  if (!this->_internal_sparsebitmap().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_sparsebitmap());
+  }
+
   // .tcp_io_device.VariableDescription metaData = 1;
   if (this->_internal_has_metadata()) {
     total_size += 1 +
@@ -2580,9 +4549,21 @@ void ProtoVariable::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  _this->_impl_.doubledata_.MergeFrom(from._impl_.doubledata_);
+  _this->_impl_.int64data_.MergeFrom(from._impl_.int64data_);
+  _this->_impl_.booldata_.MergeFrom(from._impl_.booldata_);
+  _this->_impl_.floatdata_.MergeFrom(from._impl_.floatdata_);
+  _this->_impl_.int32data_.MergeFrom(from._impl_.int32data_);
+  _this->_impl_.uint32data_.MergeFrom(from._impl_.uint32data_);
+  _this->_impl_.uint64data_.MergeFrom(from._impl_.uint64data_);
+  _this->_impl_.sparseindices_.MergeFrom(from._impl_.sparseindices_);
+  _this->_impl_.deltaranges_.MergeFrom(from._impl_.deltaranges_);
   if (!from._internal_data().empty()) {
     _this->_internal_set_data(from._internal_data());
   }
+  if (!from._internal_sparsebitmap().empty()) {
+    _this->_internal_set_sparsebitmap(from._internal_sparsebitmap());
+  }
   if (from._internal_has_metadata()) {
     _this->_internal_mutable_metadata()->::tcp_io_device::VariableDescription::MergeFrom(
         from._internal_metadata());
@@ -2606,17 +4587,30 @@ void ProtoVariable::InternalSwap(ProtoVariable* other) {
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.doubledata_.InternalSwap(&other->_impl_.doubledata_);
+  _impl_.int64data_.InternalSwap(&other->_impl_.int64data_);
+  _impl_.booldata_.InternalSwap(&other->_impl_.booldata_);
+  _impl_.floatdata_.InternalSwap(&other->_impl_.floatdata_);
+  _impl_.int32data_.InternalSwap(&other->_impl_.int32data_);
+  _impl_.uint32data_.InternalSwap(&other->_impl_.uint32data_);
+  _impl_.uint64data_.InternalSwap(&other->_impl_.uint64data_);
+  _impl_.sparseindices_.InternalSwap(&other->_impl_.sparseindices_);
+  _impl_.deltaranges_.InternalSwap(&other->_impl_.deltaranges_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
       &_impl_.data_, lhs_arena,
       &other->_impl_.data_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.sparsebitmap_, lhs_arena,
+      &other->_impl_.sparsebitmap_, rhs_arena
+  );
   swap(_impl_.metadata_, other->_impl_.metadata_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ProtoVariable::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_tcp_5fdata_5fmessage_2eproto_getter, &descriptor_table_tcp_5fdata_5fmessage_2eproto_once,
-      file_level_metadata_tcp_5fdata_5fmessage_2eproto[10]);
+      file_level_metadata_tcp_5fdata_5fmessage_2eproto[13]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -2658,6 +4652,18 @@ template<> PROTOBUF_NOINLINE ::tcp_io_device::DataMessage*
 Arena::CreateMaybeMessage< ::tcp_io_device::DataMessage >(Arena* arena) {
   return Arena::CreateMessageInternal< ::tcp_io_device::DataMessage >(arena);
 }
+template<> PROTOBUF_NOINLINE ::tcp_io_device::BatchMessage*
+Arena::CreateMaybeMessage< ::tcp_io_device::BatchMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tcp_io_device::BatchMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tcp_io_device::SubscriptionMessage*
+Arena::CreateMaybeMessage< ::tcp_io_device::SubscriptionMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tcp_io_device::SubscriptionMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tcp_io_device::Subscription*
+Arena::CreateMaybeMessage< ::tcp_io_device::Subscription >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tcp_io_device::Subscription >(arena);
+}
 template<> PROTOBUF_NOINLINE ::tcp_io_device::VariableDescription*
 Arena::CreateMaybeMessage< ::tcp_io_device::VariableDescription >(Arena* arena) {
   return Arena::CreateMessageInternal< ::tcp_io_device::VariableDescription >(arena);
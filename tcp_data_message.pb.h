@@ -13,7 +13,7 @@
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3021008 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -50,6 +50,9 @@ struct TableStruct_tcp_5fdata_5fmessage_2eproto {
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_tcp_5fdata_5fmessage_2eproto;
 namespace tcp_io_device {
+class BatchMessage;
+struct BatchMessageDefaultTypeInternal;
+extern BatchMessageDefaultTypeInternal _BatchMessage_default_instance_;
 class CommandDescription;
 struct CommandDescriptionDefaultTypeInternal;
 extern CommandDescriptionDefaultTypeInternal _CommandDescription_default_instance_;
@@ -77,6 +80,12 @@ extern StartMessageDefaultTypeInternal _StartMessage_default_instance_;
 class StopMessage;
 struct StopMessageDefaultTypeInternal;
 extern StopMessageDefaultTypeInternal _StopMessage_default_instance_;
+class Subscription;
+struct SubscriptionDefaultTypeInternal;
+extern SubscriptionDefaultTypeInternal _Subscription_default_instance_;
+class SubscriptionMessage;
+struct SubscriptionMessageDefaultTypeInternal;
+extern SubscriptionMessageDefaultTypeInternal _SubscriptionMessage_default_instance_;
 class TCPMessage;
 struct TCPMessageDefaultTypeInternal;
 extern TCPMessageDefaultTypeInternal _TCPMessage_default_instance_;
@@ -85,6 +94,7 @@ struct VariableDescriptionDefaultTypeInternal;
 extern VariableDescriptionDefaultTypeInternal _VariableDescription_default_instance_;
 }  // namespace tcp_io_device
 PROTOBUF_NAMESPACE_OPEN
+template<> ::tcp_io_device::BatchMessage* Arena::CreateMaybeMessage<::tcp_io_device::BatchMessage>(Arena*);
 template<> ::tcp_io_device::CommandDescription* Arena::CreateMaybeMessage<::tcp_io_device::CommandDescription>(Arena*);
 template<> ::tcp_io_device::DataMessage* Arena::CreateMaybeMessage<::tcp_io_device::DataMessage>(Arena*);
 template<> ::tcp_io_device::ProtoVariable* Arena::CreateMaybeMessage<::tcp_io_device::ProtoVariable>(Arena*);
@@ -94,6 +104,8 @@ template<> ::tcp_io_device::SetupMessage_EntitiesEntry_DoNotUse* Arena::CreateMa
 template<> ::tcp_io_device::SetupMessage_ObjectsEntry_DoNotUse* Arena::CreateMaybeMessage<::tcp_io_device::SetupMessage_ObjectsEntry_DoNotUse>(Arena*);
 template<> ::tcp_io_device::StartMessage* Arena::CreateMaybeMessage<::tcp_io_device::StartMessage>(Arena*);
 template<> ::tcp_io_device::StopMessage* Arena::CreateMaybeMessage<::tcp_io_device::StopMessage>(Arena*);
+template<> ::tcp_io_device::Subscription* Arena::CreateMaybeMessage<::tcp_io_device::Subscription>(Arena*);
+template<> ::tcp_io_device::SubscriptionMessage* Arena::CreateMaybeMessage<::tcp_io_device::SubscriptionMessage>(Arena*);
 template<> ::tcp_io_device::TCPMessage* Arena::CreateMaybeMessage<::tcp_io_device::TCPMessage>(Arena*);
 template<> ::tcp_io_device::VariableDescription* Arena::CreateMaybeMessage<::tcp_io_device::VariableDescription>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
@@ -105,12 +117,14 @@ enum TCPMessage_Type : int {
   TCPMessage_Type_START = 2,
   TCPMessage_Type_STOP = 3,
   TCPMessage_Type_RECONNECT = 4,
+  TCPMessage_Type_BATCH = 5,
+  TCPMessage_Type_SUBSCRIPTION = 6,
   TCPMessage_Type_TCPMessage_Type_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
   TCPMessage_Type_TCPMessage_Type_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool TCPMessage_Type_IsValid(int value);
 constexpr TCPMessage_Type TCPMessage_Type_Type_MIN = TCPMessage_Type_SETUP;
-constexpr TCPMessage_Type TCPMessage_Type_Type_MAX = TCPMessage_Type_RECONNECT;
+constexpr TCPMessage_Type TCPMessage_Type_Type_MAX = TCPMessage_Type_SUBSCRIPTION;
 constexpr int TCPMessage_Type_Type_ARRAYSIZE = TCPMessage_Type_Type_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TCPMessage_Type_descriptor();
@@ -127,6 +141,31 @@ inline bool TCPMessage_Type_Parse(
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TCPMessage_Type>(
     TCPMessage_Type_descriptor(), name, value);
 }
+enum TCPMessage_ByteOrder : int {
+  TCPMessage_ByteOrder_LITTLE = 0,
+  TCPMessage_ByteOrder_BIG = 1,
+  TCPMessage_ByteOrder_TCPMessage_ByteOrder_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  TCPMessage_ByteOrder_TCPMessage_ByteOrder_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool TCPMessage_ByteOrder_IsValid(int value);
+constexpr TCPMessage_ByteOrder TCPMessage_ByteOrder_ByteOrder_MIN = TCPMessage_ByteOrder_LITTLE;
+constexpr TCPMessage_ByteOrder TCPMessage_ByteOrder_ByteOrder_MAX = TCPMessage_ByteOrder_BIG;
+constexpr int TCPMessage_ByteOrder_ByteOrder_ARRAYSIZE = TCPMessage_ByteOrder_ByteOrder_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TCPMessage_ByteOrder_descriptor();
+template<typename T>
+inline const std::string& TCPMessage_ByteOrder_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, TCPMessage_ByteOrder>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function TCPMessage_ByteOrder_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    TCPMessage_ByteOrder_descriptor(), enum_t_value);
+}
+inline bool TCPMessage_ByteOrder_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TCPMessage_ByteOrder* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TCPMessage_ByteOrder>(
+    TCPMessage_ByteOrder_descriptor(), name, value);
+}
 enum StartMessage_ReconnectionType : int {
   StartMessage_ReconnectionType_RE_INIT = 0,
   StartMessage_ReconnectionType_RE_SETUP = 1,
@@ -153,9 +192,64 @@ inline bool StartMessage_ReconnectionType_Parse(
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<StartMessage_ReconnectionType>(
     StartMessage_ReconnectionType_descriptor(), name, value);
 }
+enum StartMessage_Compression : int {
+  StartMessage_Compression_NO_COMPRESSION = 0,
+  StartMessage_Compression_LZ4 = 1,
+  StartMessage_Compression_ZSTD = 2,
+  StartMessage_Compression_StartMessage_Compression_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  StartMessage_Compression_StartMessage_Compression_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool StartMessage_Compression_IsValid(int value);
+constexpr StartMessage_Compression StartMessage_Compression_Compression_MIN = StartMessage_Compression_NO_COMPRESSION;
+constexpr StartMessage_Compression StartMessage_Compression_Compression_MAX = StartMessage_Compression_ZSTD;
+constexpr int StartMessage_Compression_Compression_ARRAYSIZE = StartMessage_Compression_Compression_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StartMessage_Compression_descriptor();
+template<typename T>
+inline const std::string& StartMessage_Compression_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, StartMessage_Compression>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function StartMessage_Compression_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    StartMessage_Compression_descriptor(), enum_t_value);
+}
+inline bool StartMessage_Compression_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, StartMessage_Compression* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<StartMessage_Compression>(
+    StartMessage_Compression_descriptor(), name, value);
+}
+enum StartMessage_Framing : int {
+  StartMessage_Framing_LENGTH_PREFIX = 0,
+  StartMessage_Framing_VARINT_DELIMITED = 1,
+  StartMessage_Framing_StartMessage_Framing_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  StartMessage_Framing_StartMessage_Framing_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool StartMessage_Framing_IsValid(int value);
+constexpr StartMessage_Framing StartMessage_Framing_Framing_MIN = StartMessage_Framing_LENGTH_PREFIX;
+constexpr StartMessage_Framing StartMessage_Framing_Framing_MAX = StartMessage_Framing_VARINT_DELIMITED;
+constexpr int StartMessage_Framing_Framing_ARRAYSIZE = StartMessage_Framing_Framing_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StartMessage_Framing_descriptor();
+template<typename T>
+inline const std::string& StartMessage_Framing_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, StartMessage_Framing>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function StartMessage_Framing_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    StartMessage_Framing_descriptor(), enum_t_value);
+}
+inline bool StartMessage_Framing_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, StartMessage_Framing* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<StartMessage_Framing>(
+    StartMessage_Framing_descriptor(), name, value);
+}
 enum VariableDescription_DataType : int {
   VariableDescription_DataType_DOUBLE = 0,
+  VariableDescription_DataType_FLOAT = 1,
+  VariableDescription_DataType_INT32 = 2,
   VariableDescription_DataType_INT64 = 3,
+  VariableDescription_DataType_UINT32 = 4,
+  VariableDescription_DataType_UINT64 = 5,
   VariableDescription_DataType_BOOL = 12,
   VariableDescription_DataType_STRING = 13,
   VariableDescription_DataType_BYTES = 14,
@@ -182,6 +276,42 @@ inline bool VariableDescription_DataType_Parse(
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<VariableDescription_DataType>(
     VariableDescription_DataType_descriptor(), name, value);
 }
+enum VariableDescription_Encoding : int {
+  VariableDescription_Encoding_RAW = 0,
+  VariableDescription_Encoding_PACKED = 1,
+  VariableDescription_Encoding_FLOAT16 = 2,
+  VariableDescription_Encoding_BFLOAT16 = 3,
+  VariableDescription_Encoding_LINEAR_INT8 = 4,
+  VariableDescription_Encoding_LINEAR_INT16 = 5,
+  VariableDescription_Encoding_BIT_PACKED = 6,
+  VariableDescription_Encoding_SPARSE_COORDINATE = 7,
+  VariableDescription_Encoding_SPARSE_BITMAP = 8,
+  VariableDescription_Encoding_GORILLA = 9,
+  VariableDescription_Encoding_DELTA_VARINT = 10,
+  VariableDescription_Encoding_DELTA_RANGES = 11,
+  VariableDescription_Encoding_DELTA_KEYFRAME = 12,
+  VariableDescription_Encoding_VariableDescription_Encoding_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  VariableDescription_Encoding_VariableDescription_Encoding_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool VariableDescription_Encoding_IsValid(int value);
+constexpr VariableDescription_Encoding VariableDescription_Encoding_Encoding_MIN = VariableDescription_Encoding_RAW;
+constexpr VariableDescription_Encoding VariableDescription_Encoding_Encoding_MAX = VariableDescription_Encoding_DELTA_KEYFRAME;
+constexpr int VariableDescription_Encoding_Encoding_ARRAYSIZE = VariableDescription_Encoding_Encoding_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* VariableDescription_Encoding_descriptor();
+template<typename T>
+inline const std::string& VariableDescription_Encoding_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, VariableDescription_Encoding>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function VariableDescription_Encoding_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    VariableDescription_Encoding_descriptor(), enum_t_value);
+}
+inline bool VariableDescription_Encoding_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, VariableDescription_Encoding* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<VariableDescription_Encoding>(
+    VariableDescription_Encoding_descriptor(), name, value);
+}
 // ===================================================================
 
 class TCPMessage final :
@@ -232,6 +362,8 @@ class TCPMessage final :
     kDataMessage = 3,
     kStartMessage = 4,
     kStopMessage = 5,
+    kBatchMessage = 7,
+    kSubscriptionMessage = 8,
     MESSAGE_NOT_SET = 0,
   };
 
@@ -321,6 +453,10 @@ class TCPMessage final :
     TCPMessage_Type_STOP;
   static constexpr Type RECONNECT =
     TCPMessage_Type_RECONNECT;
+  static constexpr Type BATCH =
+    TCPMessage_Type_BATCH;
+  static constexpr Type SUBSCRIPTION =
+    TCPMessage_Type_SUBSCRIPTION;
   static inline bool Type_IsValid(int value) {
     return TCPMessage_Type_IsValid(value);
   }
@@ -346,6 +482,36 @@ class TCPMessage final :
     return TCPMessage_Type_Parse(name, value);
   }
 
+  typedef TCPMessage_ByteOrder ByteOrder;
+  static constexpr ByteOrder LITTLE =
+    TCPMessage_ByteOrder_LITTLE;
+  static constexpr ByteOrder BIG =
+    TCPMessage_ByteOrder_BIG;
+  static inline bool ByteOrder_IsValid(int value) {
+    return TCPMessage_ByteOrder_IsValid(value);
+  }
+  static constexpr ByteOrder ByteOrder_MIN =
+    TCPMessage_ByteOrder_ByteOrder_MIN;
+  static constexpr ByteOrder ByteOrder_MAX =
+    TCPMessage_ByteOrder_ByteOrder_MAX;
+  static constexpr int ByteOrder_ARRAYSIZE =
+    TCPMessage_ByteOrder_ByteOrder_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  ByteOrder_descriptor() {
+    return TCPMessage_ByteOrder_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& ByteOrder_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, ByteOrder>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function ByteOrder_Name.");
+    return TCPMessage_ByteOrder_Name(enum_t_value);
+  }
+  static inline bool ByteOrder_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      ByteOrder* value) {
+    return TCPMessage_ByteOrder_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   enum : int {
@@ -355,6 +521,8 @@ class TCPMessage final :
     kDataMessageFieldNumber = 3,
     kStartMessageFieldNumber = 4,
     kStopMessageFieldNumber = 5,
+    kBatchMessageFieldNumber = 7,
+    kSubscriptionMessageFieldNumber = 8,
   };
   // uint64 timestamp = 6;
   void clear_timestamp();
@@ -446,6 +614,42 @@ class TCPMessage final :
       ::tcp_io_device::StopMessage* stopmessage);
   ::tcp_io_device::StopMessage* unsafe_arena_release_stopmessage();
 
+  // .tcp_io_device.BatchMessage batchMessage = 7;
+  bool has_batchmessage() const;
+  private:
+  bool _internal_has_batchmessage() const;
+  public:
+  void clear_batchmessage();
+  const ::tcp_io_device::BatchMessage& batchmessage() const;
+  PROTOBUF_NODISCARD ::tcp_io_device::BatchMessage* release_batchmessage();
+  ::tcp_io_device::BatchMessage* mutable_batchmessage();
+  void set_allocated_batchmessage(::tcp_io_device::BatchMessage* batchmessage);
+  private:
+  const ::tcp_io_device::BatchMessage& _internal_batchmessage() const;
+  ::tcp_io_device::BatchMessage* _internal_mutable_batchmessage();
+  public:
+  void unsafe_arena_set_allocated_batchmessage(
+      ::tcp_io_device::BatchMessage* batchmessage);
+  ::tcp_io_device::BatchMessage* unsafe_arena_release_batchmessage();
+
+  // .tcp_io_device.SubscriptionMessage subscriptionMessage = 8;
+  bool has_subscriptionmessage() const;
+  private:
+  bool _internal_has_subscriptionmessage() const;
+  public:
+  void clear_subscriptionmessage();
+  const ::tcp_io_device::SubscriptionMessage& subscriptionmessage() const;
+  PROTOBUF_NODISCARD ::tcp_io_device::SubscriptionMessage* release_subscriptionmessage();
+  ::tcp_io_device::SubscriptionMessage* mutable_subscriptionmessage();
+  void set_allocated_subscriptionmessage(::tcp_io_device::SubscriptionMessage* subscriptionmessage);
+  private:
+  const ::tcp_io_device::SubscriptionMessage& _internal_subscriptionmessage() const;
+  ::tcp_io_device::SubscriptionMessage* _internal_mutable_subscriptionmessage();
+  public:
+  void unsafe_arena_set_allocated_subscriptionmessage(
+      ::tcp_io_device::SubscriptionMessage* subscriptionmessage);
+  ::tcp_io_device::SubscriptionMessage* unsafe_arena_release_subscriptionmessage();
+
   void clear_message();
   MessageCase message_case() const;
   // @@protoc_insertion_point(class_scope:tcp_io_device.TCPMessage)
@@ -455,6 +659,8 @@ class TCPMessage final :
   void set_has_datamessage();
   void set_has_startmessage();
   void set_has_stopmessage();
+  void set_has_batchmessage();
+  void set_has_subscriptionmessage();
 
   inline bool has_message() const;
   inline void clear_has_message();
@@ -472,6 +678,8 @@ class TCPMessage final :
       ::tcp_io_device::DataMessage* datamessage_;
       ::tcp_io_device::StartMessage* startmessage_;
       ::tcp_io_device::StopMessage* stopmessage_;
+      ::tcp_io_device::BatchMessage* batchmessage_;
+      ::tcp_io_device::SubscriptionMessage* subscriptionmessage_;
     } message_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     uint32_t _oneof_case_[1];
@@ -632,12 +840,101 @@ class StartMessage final :
     return StartMessage_ReconnectionType_Parse(name, value);
   }
 
+  typedef StartMessage_Compression Compression;
+  static constexpr Compression NO_COMPRESSION =
+    StartMessage_Compression_NO_COMPRESSION;
+  static constexpr Compression LZ4 =
+    StartMessage_Compression_LZ4;
+  static constexpr Compression ZSTD =
+    StartMessage_Compression_ZSTD;
+  static inline bool Compression_IsValid(int value) {
+    return StartMessage_Compression_IsValid(value);
+  }
+  static constexpr Compression Compression_MIN =
+    StartMessage_Compression_Compression_MIN;
+  static constexpr Compression Compression_MAX =
+    StartMessage_Compression_Compression_MAX;
+  static constexpr int Compression_ARRAYSIZE =
+    StartMessage_Compression_Compression_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Compression_descriptor() {
+    return StartMessage_Compression_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Compression_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Compression>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Compression_Name.");
+    return StartMessage_Compression_Name(enum_t_value);
+  }
+  static inline bool Compression_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Compression* value) {
+    return StartMessage_Compression_Parse(name, value);
+  }
+
+  typedef StartMessage_Framing Framing;
+  static constexpr Framing LENGTH_PREFIX =
+    StartMessage_Framing_LENGTH_PREFIX;
+  static constexpr Framing VARINT_DELIMITED =
+    StartMessage_Framing_VARINT_DELIMITED;
+  static inline bool Framing_IsValid(int value) {
+    return StartMessage_Framing_IsValid(value);
+  }
+  static constexpr Framing Framing_MIN =
+    StartMessage_Framing_Framing_MIN;
+  static constexpr Framing Framing_MAX =
+    StartMessage_Framing_Framing_MAX;
+  static constexpr int Framing_ARRAYSIZE =
+    StartMessage_Framing_Framing_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Framing_descriptor() {
+    return StartMessage_Framing_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Framing_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Framing>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Framing_Name.");
+    return StartMessage_Framing_Name(enum_t_value);
+  }
+  static inline bool Framing_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Framing* value) {
+    return StartMessage_Framing_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   enum : int {
-    kDiagnosticModeFieldNumber = 1,
     kReconnectionTypeFieldNumber = 2,
+    kByteOrderFieldNumber = 3,
+    kDiagnosticModeFieldNumber = 1,
+    kTimeSeriesCodecFieldNumber = 4,
+    kFrameDeltaFieldNumber = 5,
+    kFrameHeaderFieldNumber = 8,
+    kCompressionFieldNumber = 6,
+    kCompressionThresholdFieldNumber = 7,
+    kFramingFieldNumber = 9,
+    kMaxBatchSizeFieldNumber = 10,
+    kMaxBatchLatencyUsFieldNumber = 11,
   };
+  // .tcp_io_device.StartMessage.ReconnectionType reconnectionType = 2;
+  void clear_reconnectiontype();
+  ::tcp_io_device::StartMessage_ReconnectionType reconnectiontype() const;
+  void set_reconnectiontype(::tcp_io_device::StartMessage_ReconnectionType value);
+  private:
+  ::tcp_io_device::StartMessage_ReconnectionType _internal_reconnectiontype() const;
+  void _internal_set_reconnectiontype(::tcp_io_device::StartMessage_ReconnectionType value);
+  public:
+
+  // .tcp_io_device.TCPMessage.ByteOrder byteOrder = 3;
+  void clear_byteorder();
+  ::tcp_io_device::TCPMessage_ByteOrder byteorder() const;
+  void set_byteorder(::tcp_io_device::TCPMessage_ByteOrder value);
+  private:
+  ::tcp_io_device::TCPMessage_ByteOrder _internal_byteorder() const;
+  void _internal_set_byteorder(::tcp_io_device::TCPMessage_ByteOrder value);
+  public:
+
   // bool diagnosticMode = 1;
   void clear_diagnosticmode();
   bool diagnosticmode() const;
@@ -647,13 +944,76 @@ class StartMessage final :
   void _internal_set_diagnosticmode(bool value);
   public:
 
-  // .tcp_io_device.StartMessage.ReconnectionType reconnectionType = 2;
-  void clear_reconnectiontype();
-  ::tcp_io_device::StartMessage_ReconnectionType reconnectiontype() const;
-  void set_reconnectiontype(::tcp_io_device::StartMessage_ReconnectionType value);
+  // bool timeSeriesCodec = 4;
+  void clear_timeseriescodec();
+  bool timeseriescodec() const;
+  void set_timeseriescodec(bool value);
   private:
-  ::tcp_io_device::StartMessage_ReconnectionType _internal_reconnectiontype() const;
-  void _internal_set_reconnectiontype(::tcp_io_device::StartMessage_ReconnectionType value);
+  bool _internal_timeseriescodec() const;
+  void _internal_set_timeseriescodec(bool value);
+  public:
+
+  // bool frameDelta = 5;
+  void clear_framedelta();
+  bool framedelta() const;
+  void set_framedelta(bool value);
+  private:
+  bool _internal_framedelta() const;
+  void _internal_set_framedelta(bool value);
+  public:
+
+  // bool frameHeader = 8;
+  void clear_frameheader();
+  bool frameheader() const;
+  void set_frameheader(bool value);
+  private:
+  bool _internal_frameheader() const;
+  void _internal_set_frameheader(bool value);
+  public:
+
+  // .tcp_io_device.StartMessage.Compression compression = 6;
+  void clear_compression();
+  ::tcp_io_device::StartMessage_Compression compression() const;
+  void set_compression(::tcp_io_device::StartMessage_Compression value);
+  private:
+  ::tcp_io_device::StartMessage_Compression _internal_compression() const;
+  void _internal_set_compression(::tcp_io_device::StartMessage_Compression value);
+  public:
+
+  // uint64 compressionThreshold = 7;
+  void clear_compressionthreshold();
+  uint64_t compressionthreshold() const;
+  void set_compressionthreshold(uint64_t value);
+  private:
+  uint64_t _internal_compressionthreshold() const;
+  void _internal_set_compressionthreshold(uint64_t value);
+  public:
+
+  // .tcp_io_device.StartMessage.Framing framing = 9;
+  void clear_framing();
+  ::tcp_io_device::StartMessage_Framing framing() const;
+  void set_framing(::tcp_io_device::StartMessage_Framing value);
+  private:
+  ::tcp_io_device::StartMessage_Framing _internal_framing() const;
+  void _internal_set_framing(::tcp_io_device::StartMessage_Framing value);
+  public:
+
+  // uint32 maxBatchSize = 10;
+  void clear_maxbatchsize();
+  uint32_t maxbatchsize() const;
+  void set_maxbatchsize(uint32_t value);
+  private:
+  uint32_t _internal_maxbatchsize() const;
+  void _internal_set_maxbatchsize(uint32_t value);
+  public:
+
+  // uint64 maxBatchLatencyUs = 11;
+  void clear_maxbatchlatencyus();
+  uint64_t maxbatchlatencyus() const;
+  void set_maxbatchlatencyus(uint64_t value);
+  private:
+  uint64_t _internal_maxbatchlatencyus() const;
+  void _internal_set_maxbatchlatencyus(uint64_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:tcp_io_device.StartMessage)
@@ -664,8 +1024,17 @@ class StartMessage final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    bool diagnosticmode_;
     int reconnectiontype_;
+    int byteorder_;
+    bool diagnosticmode_;
+    bool timeseriescodec_;
+    bool framedelta_;
+    bool frameheader_;
+    int compression_;
+    uint64_t compressionthreshold_;
+    int framing_;
+    uint32_t maxbatchsize_;
+    uint64_t maxbatchlatencyus_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -997,6 +1366,8 @@ class SetupMessage final :
     kObjectsFieldNumber = 2,
     kCommandsFieldNumber = 3,
     kCommandDescriptionsFieldNumber = 4,
+    kSupportedCompressionsFieldNumber = 6,
+    kByteOrderFieldNumber = 5,
   };
   // map<string, int32> entities = 1;
   int entities_size() const;
@@ -1067,6 +1438,32 @@ class SetupMessage final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tcp_io_device::CommandDescription >&
       commanddescriptions() const;
 
+  // repeated .tcp_io_device.StartMessage.Compression supportedCompressions = 6;
+  int supportedcompressions_size() const;
+  private:
+  int _internal_supportedcompressions_size() const;
+  public:
+  void clear_supportedcompressions();
+  private:
+  ::tcp_io_device::StartMessage_Compression _internal_supportedcompressions(int index) const;
+  void _internal_add_supportedcompressions(::tcp_io_device::StartMessage_Compression value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_supportedcompressions();
+  public:
+  ::tcp_io_device::StartMessage_Compression supportedcompressions(int index) const;
+  void set_supportedcompressions(int index, ::tcp_io_device::StartMessage_Compression value);
+  void add_supportedcompressions(::tcp_io_device::StartMessage_Compression value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& supportedcompressions() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_supportedcompressions();
+
+  // .tcp_io_device.TCPMessage.ByteOrder byteOrder = 5;
+  void clear_byteorder();
+  ::tcp_io_device::TCPMessage_ByteOrder byteorder() const;
+  void set_byteorder(::tcp_io_device::TCPMessage_ByteOrder value);
+  private:
+  ::tcp_io_device::TCPMessage_ByteOrder _internal_byteorder() const;
+  void _internal_set_byteorder(::tcp_io_device::TCPMessage_ByteOrder value);
+  public:
+
   // @@protoc_insertion_point(class_scope:tcp_io_device.SetupMessage)
  private:
   class _Internal;
@@ -1091,6 +1488,9 @@ class SetupMessage final :
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32> commands_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tcp_io_device::CommandDescription > commanddescriptions_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> supportedcompressions_;
+    mutable std::atomic<int> _supportedcompressions_cached_byte_size_;
+    int byteorder_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1439,24 +1839,24 @@ class DataMessage final :
 };
 // -------------------------------------------------------------------
 
-class VariableDescription final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tcp_io_device.VariableDescription) */ {
+class BatchMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tcp_io_device.BatchMessage) */ {
  public:
-  inline VariableDescription() : VariableDescription(nullptr) {}
-  ~VariableDescription() override;
-  explicit PROTOBUF_CONSTEXPR VariableDescription(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BatchMessage() : BatchMessage(nullptr) {}
+  ~BatchMessage() override;
+  explicit PROTOBUF_CONSTEXPR BatchMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  VariableDescription(const VariableDescription& from);
-  VariableDescription(VariableDescription&& from) noexcept
-    : VariableDescription() {
+  BatchMessage(const BatchMessage& from);
+  BatchMessage(BatchMessage&& from) noexcept
+    : BatchMessage() {
     *this = ::std::move(from);
   }
 
-  inline VariableDescription& operator=(const VariableDescription& from) {
+  inline BatchMessage& operator=(const BatchMessage& from) {
     CopyFrom(from);
     return *this;
   }
-  inline VariableDescription& operator=(VariableDescription&& from) noexcept {
+  inline BatchMessage& operator=(BatchMessage&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1479,20 +1879,20 @@ class VariableDescription final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const VariableDescription& default_instance() {
+  static const BatchMessage& default_instance() {
     return *internal_default_instance();
   }
-  static inline const VariableDescription* internal_default_instance() {
-    return reinterpret_cast<const VariableDescription*>(
-               &_VariableDescription_default_instance_);
+  static inline const BatchMessage* internal_default_instance() {
+    return reinterpret_cast<const BatchMessage*>(
+               &_BatchMessage_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     9;
 
-  friend void swap(VariableDescription& a, VariableDescription& b) {
+  friend void swap(BatchMessage& a, BatchMessage& b) {
     a.Swap(&b);
   }
-  inline void Swap(VariableDescription* other) {
+  inline void Swap(BatchMessage* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1505,7 +1905,7 @@ class VariableDescription final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(VariableDescription* other) {
+  void UnsafeArenaSwap(BatchMessage* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1513,14 +1913,14 @@ class VariableDescription final :
 
   // implements Message ----------------------------------------------
 
-  VariableDescription* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<VariableDescription>(arena);
+  BatchMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchMessage>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const VariableDescription& from);
+  void CopyFrom(const BatchMessage& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const VariableDescription& from) {
-    VariableDescription::MergeImpl(*this, from);
+  void MergeFrom( const BatchMessage& from) {
+    BatchMessage::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1538,15 +1938,15 @@ class VariableDescription final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(VariableDescription* other);
+  void InternalSwap(BatchMessage* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "tcp_io_device.VariableDescription";
+    return "tcp_io_device.BatchMessage";
   }
   protected:
-  explicit VariableDescription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BatchMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1557,117 +1957,53 @@ class VariableDescription final :
 
   // nested types ----------------------------------------------------
 
-  typedef VariableDescription_DataType DataType;
-  static constexpr DataType DOUBLE =
-    VariableDescription_DataType_DOUBLE;
-  static constexpr DataType INT64 =
-    VariableDescription_DataType_INT64;
-  static constexpr DataType BOOL =
-    VariableDescription_DataType_BOOL;
-  static constexpr DataType STRING =
-    VariableDescription_DataType_STRING;
-  static constexpr DataType BYTES =
-    VariableDescription_DataType_BYTES;
-  static constexpr DataType COMMUNICATION_ID =
-    VariableDescription_DataType_COMMUNICATION_ID;
-  static inline bool DataType_IsValid(int value) {
-    return VariableDescription_DataType_IsValid(value);
-  }
-  static constexpr DataType DataType_MIN =
-    VariableDescription_DataType_DataType_MIN;
-  static constexpr DataType DataType_MAX =
-    VariableDescription_DataType_DataType_MAX;
-  static constexpr int DataType_ARRAYSIZE =
-    VariableDescription_DataType_DataType_ARRAYSIZE;
-  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
-  DataType_descriptor() {
-    return VariableDescription_DataType_descriptor();
-  }
-  template<typename T>
-  static inline const std::string& DataType_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, DataType>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function DataType_Name.");
-    return VariableDescription_DataType_Name(enum_t_value);
-  }
-  static inline bool DataType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      DataType* value) {
-    return VariableDescription_DataType_Parse(name, value);
-  }
-
   // accessors -------------------------------------------------------
 
   enum : int {
-    kDimensionsFieldNumber = 4,
-    kOpcodeStringHandleFieldNumber = 5,
-    kEntityIDFieldNumber = 1,
-    kIDFieldNumber = 2,
-    kDataTypeFieldNumber = 3,
+    kDataMessagesFieldNumber = 1,
+    kTimestampsFieldNumber = 2,
   };
-  // repeated uint64 dimensions = 4;
-  int dimensions_size() const;
-  private:
-  int _internal_dimensions_size() const;
-  public:
-  void clear_dimensions();
-  private:
-  uint64_t _internal_dimensions(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
-      _internal_dimensions() const;
-  void _internal_add_dimensions(uint64_t value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
-      _internal_mutable_dimensions();
-  public:
-  uint64_t dimensions(int index) const;
-  void set_dimensions(int index, uint64_t value);
-  void add_dimensions(uint64_t value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
-      dimensions() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
-      mutable_dimensions();
-
-  // string opcode_string_handle = 5;
-  void clear_opcode_string_handle();
-  const std::string& opcode_string_handle() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_opcode_string_handle(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_opcode_string_handle();
-  PROTOBUF_NODISCARD std::string* release_opcode_string_handle();
-  void set_allocated_opcode_string_handle(std::string* opcode_string_handle);
+  // repeated .tcp_io_device.DataMessage dataMessages = 1;
+  int datamessages_size() const;
   private:
-  const std::string& _internal_opcode_string_handle() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_opcode_string_handle(const std::string& value);
-  std::string* _internal_mutable_opcode_string_handle();
+  int _internal_datamessages_size() const;
   public:
-
-  // int32 entityID = 1;
-  void clear_entityid();
-  int32_t entityid() const;
-  void set_entityid(int32_t value);
+  void clear_datamessages();
+  ::tcp_io_device::DataMessage* mutable_datamessages(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tcp_io_device::DataMessage >*
+      mutable_datamessages();
   private:
-  int32_t _internal_entityid() const;
-  void _internal_set_entityid(int32_t value);
+  const ::tcp_io_device::DataMessage& _internal_datamessages(int index) const;
+  ::tcp_io_device::DataMessage* _internal_add_datamessages();
   public:
+  const ::tcp_io_device::DataMessage& datamessages(int index) const;
+  ::tcp_io_device::DataMessage* add_datamessages();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tcp_io_device::DataMessage >&
+      datamessages() const;
 
-  // int32 ID = 2;
-  void clear_id();
-  int32_t id() const;
-  void set_id(int32_t value);
+  // repeated uint64 timestamps = 2;
+  int timestamps_size() const;
   private:
-  int32_t _internal_id() const;
-  void _internal_set_id(int32_t value);
+  int _internal_timestamps_size() const;
   public:
-
-  // .tcp_io_device.VariableDescription.DataType dataType = 3;
-  void clear_datatype();
-  ::tcp_io_device::VariableDescription_DataType datatype() const;
-  void set_datatype(::tcp_io_device::VariableDescription_DataType value);
+  void clear_timestamps();
   private:
-  ::tcp_io_device::VariableDescription_DataType _internal_datatype() const;
-  void _internal_set_datatype(::tcp_io_device::VariableDescription_DataType value);
+  uint64_t _internal_timestamps(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_timestamps() const;
+  void _internal_add_timestamps(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_timestamps();
   public:
+  uint64_t timestamps(int index) const;
+  void set_timestamps(int index, uint64_t value);
+  void add_timestamps(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      timestamps() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_timestamps();
 
-  // @@protoc_insertion_point(class_scope:tcp_io_device.VariableDescription)
+  // @@protoc_insertion_point(class_scope:tcp_io_device.BatchMessage)
  private:
   class _Internal;
 
@@ -1675,12 +2011,9 @@ class VariableDescription final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > dimensions_;
-    mutable std::atomic<int> _dimensions_cached_byte_size_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr opcode_string_handle_;
-    int32_t entityid_;
-    int32_t id_;
-    int datatype_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tcp_io_device::DataMessage > datamessages_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > timestamps_;
+    mutable std::atomic<int> _timestamps_cached_byte_size_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1688,24 +2021,24 @@ class VariableDescription final :
 };
 // -------------------------------------------------------------------
 
-class ProtoVariable final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tcp_io_device.ProtoVariable) */ {
+class SubscriptionMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tcp_io_device.SubscriptionMessage) */ {
  public:
-  inline ProtoVariable() : ProtoVariable(nullptr) {}
-  ~ProtoVariable() override;
-  explicit PROTOBUF_CONSTEXPR ProtoVariable(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SubscriptionMessage() : SubscriptionMessage(nullptr) {}
+  ~SubscriptionMessage() override;
+  explicit PROTOBUF_CONSTEXPR SubscriptionMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ProtoVariable(const ProtoVariable& from);
-  ProtoVariable(ProtoVariable&& from) noexcept
-    : ProtoVariable() {
+  SubscriptionMessage(const SubscriptionMessage& from);
+  SubscriptionMessage(SubscriptionMessage&& from) noexcept
+    : SubscriptionMessage() {
     *this = ::std::move(from);
   }
 
-  inline ProtoVariable& operator=(const ProtoVariable& from) {
+  inline SubscriptionMessage& operator=(const SubscriptionMessage& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ProtoVariable& operator=(ProtoVariable&& from) noexcept {
+  inline SubscriptionMessage& operator=(SubscriptionMessage&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1728,20 +2061,20 @@ class ProtoVariable final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ProtoVariable& default_instance() {
+  static const SubscriptionMessage& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ProtoVariable* internal_default_instance() {
-    return reinterpret_cast<const ProtoVariable*>(
-               &_ProtoVariable_default_instance_);
+  static inline const SubscriptionMessage* internal_default_instance() {
+    return reinterpret_cast<const SubscriptionMessage*>(
+               &_SubscriptionMessage_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     10;
 
-  friend void swap(ProtoVariable& a, ProtoVariable& b) {
+  friend void swap(SubscriptionMessage& a, SubscriptionMessage& b) {
     a.Swap(&b);
   }
-  inline void Swap(ProtoVariable* other) {
+  inline void Swap(SubscriptionMessage* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1754,7 +2087,7 @@ class ProtoVariable final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ProtoVariable* other) {
+  void UnsafeArenaSwap(SubscriptionMessage* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1762,11 +2095,735 @@ class ProtoVariable final :
 
   // implements Message ----------------------------------------------
 
-  ProtoVariable* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ProtoVariable>(arena);
+  SubscriptionMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubscriptionMessage>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ProtoVariable& from);
+  void CopyFrom(const SubscriptionMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SubscriptionMessage& from) {
+    SubscriptionMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SubscriptionMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tcp_io_device.SubscriptionMessage";
+  }
+  protected:
+  explicit SubscriptionMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSubscriptionsFieldNumber = 1,
+    kIncludeOthersFieldNumber = 2,
+  };
+  // repeated .tcp_io_device.Subscription subscriptions = 1;
+  int subscriptions_size() const;
+  private:
+  int _internal_subscriptions_size() const;
+  public:
+  void clear_subscriptions();
+  ::tcp_io_device::Subscription* mutable_subscriptions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tcp_io_device::Subscription >*
+      mutable_subscriptions();
+  private:
+  const ::tcp_io_device::Subscription& _internal_subscriptions(int index) const;
+  ::tcp_io_device::Subscription* _internal_add_subscriptions();
+  public:
+  const ::tcp_io_device::Subscription& subscriptions(int index) const;
+  ::tcp_io_device::Subscription* add_subscriptions();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tcp_io_device::Subscription >&
+      subscriptions() const;
+
+  // bool includeOthers = 2;
+  void clear_includeothers();
+  bool includeothers() const;
+  void set_includeothers(bool value);
+  private:
+  bool _internal_includeothers() const;
+  void _internal_set_includeothers(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tcp_io_device.SubscriptionMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tcp_io_device::Subscription > subscriptions_;
+    bool includeothers_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_tcp_5fdata_5fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Subscription final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tcp_io_device.Subscription) */ {
+ public:
+  inline Subscription() : Subscription(nullptr) {}
+  ~Subscription() override;
+  explicit PROTOBUF_CONSTEXPR Subscription(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Subscription(const Subscription& from);
+  Subscription(Subscription&& from) noexcept
+    : Subscription() {
+    *this = ::std::move(from);
+  }
+
+  inline Subscription& operator=(const Subscription& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Subscription& operator=(Subscription&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Subscription& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Subscription* internal_default_instance() {
+    return reinterpret_cast<const Subscription*>(
+               &_Subscription_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(Subscription& a, Subscription& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Subscription* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Subscription* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Subscription* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Subscription>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Subscription& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Subscription& from) {
+    Subscription::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Subscription* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tcp_io_device.Subscription";
+  }
+  protected:
+  explicit Subscription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntityIDFieldNumber = 1,
+    kIDFieldNumber = 2,
+    kMinIntervalFieldNumber = 4,
+    kDecimationFieldNumber = 3,
+    kChangeOnlyFieldNumber = 5,
+    kDeadBandFieldNumber = 6,
+    kMaxIntervalFieldNumber = 7,
+  };
+  // int32 entityID = 1;
+  void clear_entityid();
+  int32_t entityid() const;
+  void set_entityid(int32_t value);
+  private:
+  int32_t _internal_entityid() const;
+  void _internal_set_entityid(int32_t value);
+  public:
+
+  // int32 ID = 2;
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // uint64 minInterval = 4;
+  void clear_mininterval();
+  uint64_t mininterval() const;
+  void set_mininterval(uint64_t value);
+  private:
+  uint64_t _internal_mininterval() const;
+  void _internal_set_mininterval(uint64_t value);
+  public:
+
+  // uint32 decimation = 3;
+  void clear_decimation();
+  uint32_t decimation() const;
+  void set_decimation(uint32_t value);
+  private:
+  uint32_t _internal_decimation() const;
+  void _internal_set_decimation(uint32_t value);
+  public:
+
+  // bool changeOnly = 5;
+  void clear_changeonly();
+  bool changeonly() const;
+  void set_changeonly(bool value);
+  private:
+  bool _internal_changeonly() const;
+  void _internal_set_changeonly(bool value);
+  public:
+
+  // double deadBand = 6;
+  void clear_deadband();
+  double deadband() const;
+  void set_deadband(double value);
+  private:
+  double _internal_deadband() const;
+  void _internal_set_deadband(double value);
+  public:
+
+  // uint64 maxInterval = 7;
+  void clear_maxinterval();
+  uint64_t maxinterval() const;
+  void set_maxinterval(uint64_t value);
+  private:
+  uint64_t _internal_maxinterval() const;
+  void _internal_set_maxinterval(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tcp_io_device.Subscription)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t entityid_;
+    int32_t id_;
+    uint64_t mininterval_;
+    uint32_t decimation_;
+    bool changeonly_;
+    double deadband_;
+    uint64_t maxinterval_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_tcp_5fdata_5fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class VariableDescription final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tcp_io_device.VariableDescription) */ {
+ public:
+  inline VariableDescription() : VariableDescription(nullptr) {}
+  ~VariableDescription() override;
+  explicit PROTOBUF_CONSTEXPR VariableDescription(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  VariableDescription(const VariableDescription& from);
+  VariableDescription(VariableDescription&& from) noexcept
+    : VariableDescription() {
+    *this = ::std::move(from);
+  }
+
+  inline VariableDescription& operator=(const VariableDescription& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VariableDescription& operator=(VariableDescription&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VariableDescription& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VariableDescription* internal_default_instance() {
+    return reinterpret_cast<const VariableDescription*>(
+               &_VariableDescription_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(VariableDescription& a, VariableDescription& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VariableDescription* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VariableDescription* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VariableDescription* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VariableDescription>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const VariableDescription& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const VariableDescription& from) {
+    VariableDescription::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(VariableDescription* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tcp_io_device.VariableDescription";
+  }
+  protected:
+  explicit VariableDescription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef VariableDescription_DataType DataType;
+  static constexpr DataType DOUBLE =
+    VariableDescription_DataType_DOUBLE;
+  static constexpr DataType FLOAT =
+    VariableDescription_DataType_FLOAT;
+  static constexpr DataType INT32 =
+    VariableDescription_DataType_INT32;
+  static constexpr DataType INT64 =
+    VariableDescription_DataType_INT64;
+  static constexpr DataType UINT32 =
+    VariableDescription_DataType_UINT32;
+  static constexpr DataType UINT64 =
+    VariableDescription_DataType_UINT64;
+  static constexpr DataType BOOL =
+    VariableDescription_DataType_BOOL;
+  static constexpr DataType STRING =
+    VariableDescription_DataType_STRING;
+  static constexpr DataType BYTES =
+    VariableDescription_DataType_BYTES;
+  static constexpr DataType COMMUNICATION_ID =
+    VariableDescription_DataType_COMMUNICATION_ID;
+  static inline bool DataType_IsValid(int value) {
+    return VariableDescription_DataType_IsValid(value);
+  }
+  static constexpr DataType DataType_MIN =
+    VariableDescription_DataType_DataType_MIN;
+  static constexpr DataType DataType_MAX =
+    VariableDescription_DataType_DataType_MAX;
+  static constexpr int DataType_ARRAYSIZE =
+    VariableDescription_DataType_DataType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  DataType_descriptor() {
+    return VariableDescription_DataType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& DataType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, DataType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function DataType_Name.");
+    return VariableDescription_DataType_Name(enum_t_value);
+  }
+  static inline bool DataType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      DataType* value) {
+    return VariableDescription_DataType_Parse(name, value);
+  }
+
+  typedef VariableDescription_Encoding Encoding;
+  static constexpr Encoding RAW =
+    VariableDescription_Encoding_RAW;
+  static constexpr Encoding PACKED =
+    VariableDescription_Encoding_PACKED;
+  static constexpr Encoding FLOAT16 =
+    VariableDescription_Encoding_FLOAT16;
+  static constexpr Encoding BFLOAT16 =
+    VariableDescription_Encoding_BFLOAT16;
+  static constexpr Encoding LINEAR_INT8 =
+    VariableDescription_Encoding_LINEAR_INT8;
+  static constexpr Encoding LINEAR_INT16 =
+    VariableDescription_Encoding_LINEAR_INT16;
+  static constexpr Encoding BIT_PACKED =
+    VariableDescription_Encoding_BIT_PACKED;
+  static constexpr Encoding SPARSE_COORDINATE =
+    VariableDescription_Encoding_SPARSE_COORDINATE;
+  static constexpr Encoding SPARSE_BITMAP =
+    VariableDescription_Encoding_SPARSE_BITMAP;
+  static constexpr Encoding GORILLA =
+    VariableDescription_Encoding_GORILLA;
+  static constexpr Encoding DELTA_VARINT =
+    VariableDescription_Encoding_DELTA_VARINT;
+  static constexpr Encoding DELTA_RANGES =
+    VariableDescription_Encoding_DELTA_RANGES;
+  static constexpr Encoding DELTA_KEYFRAME =
+    VariableDescription_Encoding_DELTA_KEYFRAME;
+  static inline bool Encoding_IsValid(int value) {
+    return VariableDescription_Encoding_IsValid(value);
+  }
+  static constexpr Encoding Encoding_MIN =
+    VariableDescription_Encoding_Encoding_MIN;
+  static constexpr Encoding Encoding_MAX =
+    VariableDescription_Encoding_Encoding_MAX;
+  static constexpr int Encoding_ARRAYSIZE =
+    VariableDescription_Encoding_Encoding_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Encoding_descriptor() {
+    return VariableDescription_Encoding_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Encoding_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Encoding>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Encoding_Name.");
+    return VariableDescription_Encoding_Name(enum_t_value);
+  }
+  static inline bool Encoding_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Encoding* value) {
+    return VariableDescription_Encoding_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDimensionsFieldNumber = 4,
+    kOpcodeStringHandleFieldNumber = 5,
+    kEntityIDFieldNumber = 1,
+    kIDFieldNumber = 2,
+    kDataTypeFieldNumber = 3,
+    kEncodingFieldNumber = 6,
+    kScaleFieldNumber = 7,
+    kOffsetFieldNumber = 8,
+  };
+  // repeated uint64 dimensions = 4;
+  int dimensions_size() const;
+  private:
+  int _internal_dimensions_size() const;
+  public:
+  void clear_dimensions();
+  private:
+  uint64_t _internal_dimensions(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_dimensions() const;
+  void _internal_add_dimensions(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_dimensions();
+  public:
+  uint64_t dimensions(int index) const;
+  void set_dimensions(int index, uint64_t value);
+  void add_dimensions(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      dimensions() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_dimensions();
+
+  // string opcode_string_handle = 5;
+  void clear_opcode_string_handle();
+  const std::string& opcode_string_handle() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_opcode_string_handle(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_opcode_string_handle();
+  PROTOBUF_NODISCARD std::string* release_opcode_string_handle();
+  void set_allocated_opcode_string_handle(std::string* opcode_string_handle);
+  private:
+  const std::string& _internal_opcode_string_handle() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_opcode_string_handle(const std::string& value);
+  std::string* _internal_mutable_opcode_string_handle();
+  public:
+
+  // int32 entityID = 1;
+  void clear_entityid();
+  int32_t entityid() const;
+  void set_entityid(int32_t value);
+  private:
+  int32_t _internal_entityid() const;
+  void _internal_set_entityid(int32_t value);
+  public:
+
+  // int32 ID = 2;
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // .tcp_io_device.VariableDescription.DataType dataType = 3;
+  void clear_datatype();
+  ::tcp_io_device::VariableDescription_DataType datatype() const;
+  void set_datatype(::tcp_io_device::VariableDescription_DataType value);
+  private:
+  ::tcp_io_device::VariableDescription_DataType _internal_datatype() const;
+  void _internal_set_datatype(::tcp_io_device::VariableDescription_DataType value);
+  public:
+
+  // .tcp_io_device.VariableDescription.Encoding encoding = 6;
+  void clear_encoding();
+  ::tcp_io_device::VariableDescription_Encoding encoding() const;
+  void set_encoding(::tcp_io_device::VariableDescription_Encoding value);
+  private:
+  ::tcp_io_device::VariableDescription_Encoding _internal_encoding() const;
+  void _internal_set_encoding(::tcp_io_device::VariableDescription_Encoding value);
+  public:
+
+  // double scale = 7;
+  void clear_scale();
+  double scale() const;
+  void set_scale(double value);
+  private:
+  double _internal_scale() const;
+  void _internal_set_scale(double value);
+  public:
+
+  // double offset = 8;
+  void clear_offset();
+  double offset() const;
+  void set_offset(double value);
+  private:
+  double _internal_offset() const;
+  void _internal_set_offset(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tcp_io_device.VariableDescription)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > dimensions_;
+    mutable std::atomic<int> _dimensions_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr opcode_string_handle_;
+    int32_t entityid_;
+    int32_t id_;
+    int datatype_;
+    int encoding_;
+    double scale_;
+    double offset_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_tcp_5fdata_5fmessage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ProtoVariable final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tcp_io_device.ProtoVariable) */ {
+ public:
+  inline ProtoVariable() : ProtoVariable(nullptr) {}
+  ~ProtoVariable() override;
+  explicit PROTOBUF_CONSTEXPR ProtoVariable(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ProtoVariable(const ProtoVariable& from);
+  ProtoVariable(ProtoVariable&& from) noexcept
+    : ProtoVariable() {
+    *this = ::std::move(from);
+  }
+
+  inline ProtoVariable& operator=(const ProtoVariable& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProtoVariable& operator=(ProtoVariable&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProtoVariable& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProtoVariable* internal_default_instance() {
+    return reinterpret_cast<const ProtoVariable*>(
+               &_ProtoVariable_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(ProtoVariable& a, ProtoVariable& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProtoVariable* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProtoVariable* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ProtoVariable* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProtoVariable>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ProtoVariable& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
   void MergeFrom( const ProtoVariable& from) {
     ProtoVariable::MergeImpl(*this, from);
@@ -1809,9 +2866,217 @@ class ProtoVariable final :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kDoubleDataFieldNumber = 3,
+    kInt64DataFieldNumber = 4,
+    kBoolDataFieldNumber = 5,
+    kFloatDataFieldNumber = 6,
+    kInt32DataFieldNumber = 7,
+    kUint32DataFieldNumber = 8,
+    kUint64DataFieldNumber = 9,
+    kSparseIndicesFieldNumber = 10,
+    kDeltaRangesFieldNumber = 12,
     kDataFieldNumber = 2,
+    kSparseBitmapFieldNumber = 11,
     kMetaDataFieldNumber = 1,
   };
+  // repeated double doubleData = 3;
+  int doubledata_size() const;
+  private:
+  int _internal_doubledata_size() const;
+  public:
+  void clear_doubledata();
+  private:
+  double _internal_doubledata(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_doubledata() const;
+  void _internal_add_doubledata(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_doubledata();
+  public:
+  double doubledata(int index) const;
+  void set_doubledata(int index, double value);
+  void add_doubledata(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      doubledata() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_doubledata();
+
+  // repeated sint64 int64Data = 4;
+  int int64data_size() const;
+  private:
+  int _internal_int64data_size() const;
+  public:
+  void clear_int64data();
+  private:
+  int64_t _internal_int64data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_int64data() const;
+  void _internal_add_int64data(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_int64data();
+  public:
+  int64_t int64data(int index) const;
+  void set_int64data(int index, int64_t value);
+  void add_int64data(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      int64data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_int64data();
+
+  // repeated bool boolData = 5;
+  int booldata_size() const;
+  private:
+  int _internal_booldata_size() const;
+  public:
+  void clear_booldata();
+  private:
+  bool _internal_booldata(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      _internal_booldata() const;
+  void _internal_add_booldata(bool value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      _internal_mutable_booldata();
+  public:
+  bool booldata(int index) const;
+  void set_booldata(int index, bool value);
+  void add_booldata(bool value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      booldata() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      mutable_booldata();
+
+  // repeated float floatData = 6;
+  int floatdata_size() const;
+  private:
+  int _internal_floatdata_size() const;
+  public:
+  void clear_floatdata();
+  private:
+  float _internal_floatdata(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_floatdata() const;
+  void _internal_add_floatdata(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_floatdata();
+  public:
+  float floatdata(int index) const;
+  void set_floatdata(int index, float value);
+  void add_floatdata(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      floatdata() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_floatdata();
+
+  // repeated sint32 int32Data = 7;
+  int int32data_size() const;
+  private:
+  int _internal_int32data_size() const;
+  public:
+  void clear_int32data();
+  private:
+  int32_t _internal_int32data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_int32data() const;
+  void _internal_add_int32data(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_int32data();
+  public:
+  int32_t int32data(int index) const;
+  void set_int32data(int index, int32_t value);
+  void add_int32data(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      int32data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_int32data();
+
+  // repeated uint32 uint32Data = 8;
+  int uint32data_size() const;
+  private:
+  int _internal_uint32data_size() const;
+  public:
+  void clear_uint32data();
+  private:
+  uint32_t _internal_uint32data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_uint32data() const;
+  void _internal_add_uint32data(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_uint32data();
+  public:
+  uint32_t uint32data(int index) const;
+  void set_uint32data(int index, uint32_t value);
+  void add_uint32data(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      uint32data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_uint32data();
+
+  // repeated uint64 uint64Data = 9;
+  int uint64data_size() const;
+  private:
+  int _internal_uint64data_size() const;
+  public:
+  void clear_uint64data();
+  private:
+  uint64_t _internal_uint64data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_uint64data() const;
+  void _internal_add_uint64data(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_uint64data();
+  public:
+  uint64_t uint64data(int index) const;
+  void set_uint64data(int index, uint64_t value);
+  void add_uint64data(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      uint64data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_uint64data();
+
+  // repeated uint64 sparseIndices = 10;
+  int sparseindices_size() const;
+  private:
+  int _internal_sparseindices_size() const;
+  public:
+  void clear_sparseindices();
+  private:
+  uint64_t _internal_sparseindices(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_sparseindices() const;
+  void _internal_add_sparseindices(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_sparseindices();
+  public:
+  uint64_t sparseindices(int index) const;
+  void set_sparseindices(int index, uint64_t value);
+  void add_sparseindices(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      sparseindices() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_sparseindices();
+
+  // repeated uint64 deltaRanges = 12;
+  int deltaranges_size() const;
+  private:
+  int _internal_deltaranges_size() const;
+  public:
+  void clear_deltaranges();
+  private:
+  uint64_t _internal_deltaranges(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_deltaranges() const;
+  void _internal_add_deltaranges(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_deltaranges();
+  public:
+  uint64_t deltaranges(int index) const;
+  void set_deltaranges(int index, uint64_t value);
+  void add_deltaranges(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      deltaranges() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_deltaranges();
+
   // bytes data = 2;
   void clear_data();
   const std::string& data() const;
@@ -1826,6 +3091,20 @@ class ProtoVariable final :
   std::string* _internal_mutable_data();
   public:
 
+  // bytes sparseBitmap = 11;
+  void clear_sparsebitmap();
+  const std::string& sparsebitmap() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sparsebitmap(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_sparsebitmap();
+  PROTOBUF_NODISCARD std::string* release_sparsebitmap();
+  void set_allocated_sparsebitmap(std::string* sparsebitmap);
+  private:
+  const std::string& _internal_sparsebitmap() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sparsebitmap(const std::string& value);
+  std::string* _internal_mutable_sparsebitmap();
+  public:
+
   // .tcp_io_device.VariableDescription metaData = 1;
   bool has_metadata() const;
   private:
@@ -1852,7 +3131,23 @@ class ProtoVariable final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > doubledata_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > int64data_;
+    mutable std::atomic<int> _int64data_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool > booldata_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > floatdata_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > int32data_;
+    mutable std::atomic<int> _int32data_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > uint32data_;
+    mutable std::atomic<int> _uint32data_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > uint64data_;
+    mutable std::atomic<int> _uint64data_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > sparseindices_;
+    mutable std::atomic<int> _sparseindices_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > deltaranges_;
+    mutable std::atomic<int> _deltaranges_cached_byte_size_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sparsebitmap_;
     ::tcp_io_device::VariableDescription* metadata_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
@@ -2186,77 +3481,405 @@ inline ::tcp_io_device::StopMessage* TCPMessage::mutable_stopmessage() {
   return _msg;
 }
 
-// uint64 timestamp = 6;
-inline void TCPMessage::clear_timestamp() {
-  _impl_.timestamp_ = uint64_t{0u};
+// .tcp_io_device.BatchMessage batchMessage = 7;
+inline bool TCPMessage::_internal_has_batchmessage() const {
+  return message_case() == kBatchMessage;
+}
+inline bool TCPMessage::has_batchmessage() const {
+  return _internal_has_batchmessage();
+}
+inline void TCPMessage::set_has_batchmessage() {
+  _impl_._oneof_case_[0] = kBatchMessage;
+}
+inline void TCPMessage::clear_batchmessage() {
+  if (_internal_has_batchmessage()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.message_.batchmessage_;
+    }
+    clear_has_message();
+  }
+}
+inline ::tcp_io_device::BatchMessage* TCPMessage::release_batchmessage() {
+  // @@protoc_insertion_point(field_release:tcp_io_device.TCPMessage.batchMessage)
+  if (_internal_has_batchmessage()) {
+    clear_has_message();
+    ::tcp_io_device::BatchMessage* temp = _impl_.message_.batchmessage_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.message_.batchmessage_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::tcp_io_device::BatchMessage& TCPMessage::_internal_batchmessage() const {
+  return _internal_has_batchmessage()
+      ? *_impl_.message_.batchmessage_
+      : reinterpret_cast< ::tcp_io_device::BatchMessage&>(::tcp_io_device::_BatchMessage_default_instance_);
+}
+inline const ::tcp_io_device::BatchMessage& TCPMessage::batchmessage() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.TCPMessage.batchMessage)
+  return _internal_batchmessage();
+}
+inline ::tcp_io_device::BatchMessage* TCPMessage::unsafe_arena_release_batchmessage() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:tcp_io_device.TCPMessage.batchMessage)
+  if (_internal_has_batchmessage()) {
+    clear_has_message();
+    ::tcp_io_device::BatchMessage* temp = _impl_.message_.batchmessage_;
+    _impl_.message_.batchmessage_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TCPMessage::unsafe_arena_set_allocated_batchmessage(::tcp_io_device::BatchMessage* batchmessage) {
+  clear_message();
+  if (batchmessage) {
+    set_has_batchmessage();
+    _impl_.message_.batchmessage_ = batchmessage;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tcp_io_device.TCPMessage.batchMessage)
+}
+inline ::tcp_io_device::BatchMessage* TCPMessage::_internal_mutable_batchmessage() {
+  if (!_internal_has_batchmessage()) {
+    clear_message();
+    set_has_batchmessage();
+    _impl_.message_.batchmessage_ = CreateMaybeMessage< ::tcp_io_device::BatchMessage >(GetArenaForAllocation());
+  }
+  return _impl_.message_.batchmessage_;
+}
+inline ::tcp_io_device::BatchMessage* TCPMessage::mutable_batchmessage() {
+  ::tcp_io_device::BatchMessage* _msg = _internal_mutable_batchmessage();
+  // @@protoc_insertion_point(field_mutable:tcp_io_device.TCPMessage.batchMessage)
+  return _msg;
+}
+
+// .tcp_io_device.SubscriptionMessage subscriptionMessage = 8;
+inline bool TCPMessage::_internal_has_subscriptionmessage() const {
+  return message_case() == kSubscriptionMessage;
+}
+inline bool TCPMessage::has_subscriptionmessage() const {
+  return _internal_has_subscriptionmessage();
+}
+inline void TCPMessage::set_has_subscriptionmessage() {
+  _impl_._oneof_case_[0] = kSubscriptionMessage;
+}
+inline void TCPMessage::clear_subscriptionmessage() {
+  if (_internal_has_subscriptionmessage()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.message_.subscriptionmessage_;
+    }
+    clear_has_message();
+  }
+}
+inline ::tcp_io_device::SubscriptionMessage* TCPMessage::release_subscriptionmessage() {
+  // @@protoc_insertion_point(field_release:tcp_io_device.TCPMessage.subscriptionMessage)
+  if (_internal_has_subscriptionmessage()) {
+    clear_has_message();
+    ::tcp_io_device::SubscriptionMessage* temp = _impl_.message_.subscriptionmessage_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.message_.subscriptionmessage_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::tcp_io_device::SubscriptionMessage& TCPMessage::_internal_subscriptionmessage() const {
+  return _internal_has_subscriptionmessage()
+      ? *_impl_.message_.subscriptionmessage_
+      : reinterpret_cast< ::tcp_io_device::SubscriptionMessage&>(::tcp_io_device::_SubscriptionMessage_default_instance_);
+}
+inline const ::tcp_io_device::SubscriptionMessage& TCPMessage::subscriptionmessage() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.TCPMessage.subscriptionMessage)
+  return _internal_subscriptionmessage();
+}
+inline ::tcp_io_device::SubscriptionMessage* TCPMessage::unsafe_arena_release_subscriptionmessage() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:tcp_io_device.TCPMessage.subscriptionMessage)
+  if (_internal_has_subscriptionmessage()) {
+    clear_has_message();
+    ::tcp_io_device::SubscriptionMessage* temp = _impl_.message_.subscriptionmessage_;
+    _impl_.message_.subscriptionmessage_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TCPMessage::unsafe_arena_set_allocated_subscriptionmessage(::tcp_io_device::SubscriptionMessage* subscriptionmessage) {
+  clear_message();
+  if (subscriptionmessage) {
+    set_has_subscriptionmessage();
+    _impl_.message_.subscriptionmessage_ = subscriptionmessage;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tcp_io_device.TCPMessage.subscriptionMessage)
+}
+inline ::tcp_io_device::SubscriptionMessage* TCPMessage::_internal_mutable_subscriptionmessage() {
+  if (!_internal_has_subscriptionmessage()) {
+    clear_message();
+    set_has_subscriptionmessage();
+    _impl_.message_.subscriptionmessage_ = CreateMaybeMessage< ::tcp_io_device::SubscriptionMessage >(GetArenaForAllocation());
+  }
+  return _impl_.message_.subscriptionmessage_;
+}
+inline ::tcp_io_device::SubscriptionMessage* TCPMessage::mutable_subscriptionmessage() {
+  ::tcp_io_device::SubscriptionMessage* _msg = _internal_mutable_subscriptionmessage();
+  // @@protoc_insertion_point(field_mutable:tcp_io_device.TCPMessage.subscriptionMessage)
+  return _msg;
+}
+
+// uint64 timestamp = 6;
+inline void TCPMessage::clear_timestamp() {
+  _impl_.timestamp_ = uint64_t{0u};
+}
+inline uint64_t TCPMessage::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline uint64_t TCPMessage::timestamp() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.TCPMessage.timestamp)
+  return _internal_timestamp();
+}
+inline void TCPMessage::_internal_set_timestamp(uint64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void TCPMessage::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.TCPMessage.timestamp)
+}
+
+inline bool TCPMessage::has_message() const {
+  return message_case() != MESSAGE_NOT_SET;
+}
+inline void TCPMessage::clear_has_message() {
+  _impl_._oneof_case_[0] = MESSAGE_NOT_SET;
+}
+inline TCPMessage::MessageCase TCPMessage::message_case() const {
+  return TCPMessage::MessageCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// StartMessage
+
+// bool diagnosticMode = 1;
+inline void StartMessage::clear_diagnosticmode() {
+  _impl_.diagnosticmode_ = false;
+}
+inline bool StartMessage::_internal_diagnosticmode() const {
+  return _impl_.diagnosticmode_;
+}
+inline bool StartMessage::diagnosticmode() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.StartMessage.diagnosticMode)
+  return _internal_diagnosticmode();
+}
+inline void StartMessage::_internal_set_diagnosticmode(bool value) {
+  
+  _impl_.diagnosticmode_ = value;
+}
+inline void StartMessage::set_diagnosticmode(bool value) {
+  _internal_set_diagnosticmode(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.StartMessage.diagnosticMode)
+}
+
+// .tcp_io_device.StartMessage.ReconnectionType reconnectionType = 2;
+inline void StartMessage::clear_reconnectiontype() {
+  _impl_.reconnectiontype_ = 0;
+}
+inline ::tcp_io_device::StartMessage_ReconnectionType StartMessage::_internal_reconnectiontype() const {
+  return static_cast< ::tcp_io_device::StartMessage_ReconnectionType >(_impl_.reconnectiontype_);
+}
+inline ::tcp_io_device::StartMessage_ReconnectionType StartMessage::reconnectiontype() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.StartMessage.reconnectionType)
+  return _internal_reconnectiontype();
+}
+inline void StartMessage::_internal_set_reconnectiontype(::tcp_io_device::StartMessage_ReconnectionType value) {
+  
+  _impl_.reconnectiontype_ = value;
+}
+inline void StartMessage::set_reconnectiontype(::tcp_io_device::StartMessage_ReconnectionType value) {
+  _internal_set_reconnectiontype(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.StartMessage.reconnectionType)
+}
+
+// .tcp_io_device.TCPMessage.ByteOrder byteOrder = 3;
+inline void StartMessage::clear_byteorder() {
+  _impl_.byteorder_ = 0;
+}
+inline ::tcp_io_device::TCPMessage_ByteOrder StartMessage::_internal_byteorder() const {
+  return static_cast< ::tcp_io_device::TCPMessage_ByteOrder >(_impl_.byteorder_);
+}
+inline ::tcp_io_device::TCPMessage_ByteOrder StartMessage::byteorder() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.StartMessage.byteOrder)
+  return _internal_byteorder();
+}
+inline void StartMessage::_internal_set_byteorder(::tcp_io_device::TCPMessage_ByteOrder value) {
+  
+  _impl_.byteorder_ = value;
+}
+inline void StartMessage::set_byteorder(::tcp_io_device::TCPMessage_ByteOrder value) {
+  _internal_set_byteorder(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.StartMessage.byteOrder)
+}
+
+// bool timeSeriesCodec = 4;
+inline void StartMessage::clear_timeseriescodec() {
+  _impl_.timeseriescodec_ = false;
+}
+inline bool StartMessage::_internal_timeseriescodec() const {
+  return _impl_.timeseriescodec_;
+}
+inline bool StartMessage::timeseriescodec() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.StartMessage.timeSeriesCodec)
+  return _internal_timeseriescodec();
+}
+inline void StartMessage::_internal_set_timeseriescodec(bool value) {
+  
+  _impl_.timeseriescodec_ = value;
+}
+inline void StartMessage::set_timeseriescodec(bool value) {
+  _internal_set_timeseriescodec(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.StartMessage.timeSeriesCodec)
+}
+
+// bool frameDelta = 5;
+inline void StartMessage::clear_framedelta() {
+  _impl_.framedelta_ = false;
+}
+inline bool StartMessage::_internal_framedelta() const {
+  return _impl_.framedelta_;
+}
+inline bool StartMessage::framedelta() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.StartMessage.frameDelta)
+  return _internal_framedelta();
+}
+inline void StartMessage::_internal_set_framedelta(bool value) {
+  
+  _impl_.framedelta_ = value;
+}
+inline void StartMessage::set_framedelta(bool value) {
+  _internal_set_framedelta(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.StartMessage.frameDelta)
+}
+
+// .tcp_io_device.StartMessage.Compression compression = 6;
+inline void StartMessage::clear_compression() {
+  _impl_.compression_ = 0;
+}
+inline ::tcp_io_device::StartMessage_Compression StartMessage::_internal_compression() const {
+  return static_cast< ::tcp_io_device::StartMessage_Compression >(_impl_.compression_);
+}
+inline ::tcp_io_device::StartMessage_Compression StartMessage::compression() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.StartMessage.compression)
+  return _internal_compression();
+}
+inline void StartMessage::_internal_set_compression(::tcp_io_device::StartMessage_Compression value) {
+  
+  _impl_.compression_ = value;
+}
+inline void StartMessage::set_compression(::tcp_io_device::StartMessage_Compression value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.StartMessage.compression)
+}
+
+// uint64 compressionThreshold = 7;
+inline void StartMessage::clear_compressionthreshold() {
+  _impl_.compressionthreshold_ = uint64_t{0u};
 }
-inline uint64_t TCPMessage::_internal_timestamp() const {
-  return _impl_.timestamp_;
+inline uint64_t StartMessage::_internal_compressionthreshold() const {
+  return _impl_.compressionthreshold_;
 }
-inline uint64_t TCPMessage::timestamp() const {
-  // @@protoc_insertion_point(field_get:tcp_io_device.TCPMessage.timestamp)
-  return _internal_timestamp();
+inline uint64_t StartMessage::compressionthreshold() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.StartMessage.compressionThreshold)
+  return _internal_compressionthreshold();
 }
-inline void TCPMessage::_internal_set_timestamp(uint64_t value) {
+inline void StartMessage::_internal_set_compressionthreshold(uint64_t value) {
   
-  _impl_.timestamp_ = value;
+  _impl_.compressionthreshold_ = value;
 }
-inline void TCPMessage::set_timestamp(uint64_t value) {
-  _internal_set_timestamp(value);
-  // @@protoc_insertion_point(field_set:tcp_io_device.TCPMessage.timestamp)
+inline void StartMessage::set_compressionthreshold(uint64_t value) {
+  _internal_set_compressionthreshold(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.StartMessage.compressionThreshold)
 }
 
-inline bool TCPMessage::has_message() const {
-  return message_case() != MESSAGE_NOT_SET;
+// bool frameHeader = 8;
+inline void StartMessage::clear_frameheader() {
+  _impl_.frameheader_ = false;
 }
-inline void TCPMessage::clear_has_message() {
-  _impl_._oneof_case_[0] = MESSAGE_NOT_SET;
+inline bool StartMessage::_internal_frameheader() const {
+  return _impl_.frameheader_;
 }
-inline TCPMessage::MessageCase TCPMessage::message_case() const {
-  return TCPMessage::MessageCase(_impl_._oneof_case_[0]);
+inline bool StartMessage::frameheader() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.StartMessage.frameHeader)
+  return _internal_frameheader();
+}
+inline void StartMessage::_internal_set_frameheader(bool value) {
+  
+  _impl_.frameheader_ = value;
+}
+inline void StartMessage::set_frameheader(bool value) {
+  _internal_set_frameheader(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.StartMessage.frameHeader)
 }
-// -------------------------------------------------------------------
 
-// StartMessage
+// .tcp_io_device.StartMessage.Framing framing = 9;
+inline void StartMessage::clear_framing() {
+  _impl_.framing_ = 0;
+}
+inline ::tcp_io_device::StartMessage_Framing StartMessage::_internal_framing() const {
+  return static_cast< ::tcp_io_device::StartMessage_Framing >(_impl_.framing_);
+}
+inline ::tcp_io_device::StartMessage_Framing StartMessage::framing() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.StartMessage.framing)
+  return _internal_framing();
+}
+inline void StartMessage::_internal_set_framing(::tcp_io_device::StartMessage_Framing value) {
+  
+  _impl_.framing_ = value;
+}
+inline void StartMessage::set_framing(::tcp_io_device::StartMessage_Framing value) {
+  _internal_set_framing(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.StartMessage.framing)
+}
 
-// bool diagnosticMode = 1;
-inline void StartMessage::clear_diagnosticmode() {
-  _impl_.diagnosticmode_ = false;
+// uint32 maxBatchSize = 10;
+inline void StartMessage::clear_maxbatchsize() {
+  _impl_.maxbatchsize_ = 0u;
 }
-inline bool StartMessage::_internal_diagnosticmode() const {
-  return _impl_.diagnosticmode_;
+inline uint32_t StartMessage::_internal_maxbatchsize() const {
+  return _impl_.maxbatchsize_;
 }
-inline bool StartMessage::diagnosticmode() const {
-  // @@protoc_insertion_point(field_get:tcp_io_device.StartMessage.diagnosticMode)
-  return _internal_diagnosticmode();
+inline uint32_t StartMessage::maxbatchsize() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.StartMessage.maxBatchSize)
+  return _internal_maxbatchsize();
 }
-inline void StartMessage::_internal_set_diagnosticmode(bool value) {
+inline void StartMessage::_internal_set_maxbatchsize(uint32_t value) {
   
-  _impl_.diagnosticmode_ = value;
+  _impl_.maxbatchsize_ = value;
 }
-inline void StartMessage::set_diagnosticmode(bool value) {
-  _internal_set_diagnosticmode(value);
-  // @@protoc_insertion_point(field_set:tcp_io_device.StartMessage.diagnosticMode)
+inline void StartMessage::set_maxbatchsize(uint32_t value) {
+  _internal_set_maxbatchsize(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.StartMessage.maxBatchSize)
 }
 
-// .tcp_io_device.StartMessage.ReconnectionType reconnectionType = 2;
-inline void StartMessage::clear_reconnectiontype() {
-  _impl_.reconnectiontype_ = 0;
+// uint64 maxBatchLatencyUs = 11;
+inline void StartMessage::clear_maxbatchlatencyus() {
+  _impl_.maxbatchlatencyus_ = uint64_t{0u};
 }
-inline ::tcp_io_device::StartMessage_ReconnectionType StartMessage::_internal_reconnectiontype() const {
-  return static_cast< ::tcp_io_device::StartMessage_ReconnectionType >(_impl_.reconnectiontype_);
+inline uint64_t StartMessage::_internal_maxbatchlatencyus() const {
+  return _impl_.maxbatchlatencyus_;
 }
-inline ::tcp_io_device::StartMessage_ReconnectionType StartMessage::reconnectiontype() const {
-  // @@protoc_insertion_point(field_get:tcp_io_device.StartMessage.reconnectionType)
-  return _internal_reconnectiontype();
+inline uint64_t StartMessage::maxbatchlatencyus() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.StartMessage.maxBatchLatencyUs)
+  return _internal_maxbatchlatencyus();
 }
-inline void StartMessage::_internal_set_reconnectiontype(::tcp_io_device::StartMessage_ReconnectionType value) {
+inline void StartMessage::_internal_set_maxbatchlatencyus(uint64_t value) {
   
-  _impl_.reconnectiontype_ = value;
+  _impl_.maxbatchlatencyus_ = value;
 }
-inline void StartMessage::set_reconnectiontype(::tcp_io_device::StartMessage_ReconnectionType value) {
-  _internal_set_reconnectiontype(value);
-  // @@protoc_insertion_point(field_set:tcp_io_device.StartMessage.reconnectionType)
+inline void StartMessage::set_maxbatchlatencyus(uint64_t value) {
+  _internal_set_maxbatchlatencyus(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.StartMessage.maxBatchLatencyUs)
 }
 
 // -------------------------------------------------------------------
@@ -2400,6 +4023,69 @@ SetupMessage::commanddescriptions() const {
   return _impl_.commanddescriptions_;
 }
 
+// .tcp_io_device.TCPMessage.ByteOrder byteOrder = 5;
+inline void SetupMessage::clear_byteorder() {
+  _impl_.byteorder_ = 0;
+}
+inline ::tcp_io_device::TCPMessage_ByteOrder SetupMessage::_internal_byteorder() const {
+  return static_cast< ::tcp_io_device::TCPMessage_ByteOrder >(_impl_.byteorder_);
+}
+inline ::tcp_io_device::TCPMessage_ByteOrder SetupMessage::byteorder() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.SetupMessage.byteOrder)
+  return _internal_byteorder();
+}
+inline void SetupMessage::_internal_set_byteorder(::tcp_io_device::TCPMessage_ByteOrder value) {
+  
+  _impl_.byteorder_ = value;
+}
+inline void SetupMessage::set_byteorder(::tcp_io_device::TCPMessage_ByteOrder value) {
+  _internal_set_byteorder(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.SetupMessage.byteOrder)
+}
+
+// repeated .tcp_io_device.StartMessage.Compression supportedCompressions = 6;
+inline int SetupMessage::_internal_supportedcompressions_size() const {
+  return _impl_.supportedcompressions_.size();
+}
+inline int SetupMessage::supportedcompressions_size() const {
+  return _internal_supportedcompressions_size();
+}
+inline void SetupMessage::clear_supportedcompressions() {
+  _impl_.supportedcompressions_.Clear();
+}
+inline ::tcp_io_device::StartMessage_Compression SetupMessage::_internal_supportedcompressions(int index) const {
+  return static_cast< ::tcp_io_device::StartMessage_Compression >(_impl_.supportedcompressions_.Get(index));
+}
+inline ::tcp_io_device::StartMessage_Compression SetupMessage::supportedcompressions(int index) const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.SetupMessage.supportedCompressions)
+  return _internal_supportedcompressions(index);
+}
+inline void SetupMessage::set_supportedcompressions(int index, ::tcp_io_device::StartMessage_Compression value) {
+  _impl_.supportedcompressions_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.SetupMessage.supportedCompressions)
+}
+inline void SetupMessage::_internal_add_supportedcompressions(::tcp_io_device::StartMessage_Compression value) {
+  _impl_.supportedcompressions_.Add(value);
+}
+inline void SetupMessage::add_supportedcompressions(::tcp_io_device::StartMessage_Compression value) {
+  _internal_add_supportedcompressions(value);
+  // @@protoc_insertion_point(field_add:tcp_io_device.SetupMessage.supportedCompressions)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
+SetupMessage::supportedcompressions() const {
+  // @@protoc_insertion_point(field_list:tcp_io_device.SetupMessage.supportedCompressions)
+  return _impl_.supportedcompressions_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+SetupMessage::_internal_mutable_supportedcompressions() {
+  return &_impl_.supportedcompressions_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+SetupMessage::mutable_supportedcompressions() {
+  // @@protoc_insertion_point(field_mutable_list:tcp_io_device.SetupMessage.supportedCompressions)
+  return _internal_mutable_supportedcompressions();
+}
+
 // -------------------------------------------------------------------
 
 // CommandDescription
@@ -2521,91 +4207,390 @@ inline void CommandDescription::_internal_set_name(const std::string& value) {
   
   _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* CommandDescription::_internal_mutable_name() {
-  
-  return _impl_.name_.Mutable(GetArenaForAllocation());
+inline std::string* CommandDescription::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CommandDescription::release_name() {
+  // @@protoc_insertion_point(field_release:tcp_io_device.CommandDescription.name)
+  return _impl_.name_.Release();
+}
+inline void CommandDescription::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tcp_io_device.CommandDescription.name)
+}
+
+// -------------------------------------------------------------------
+
+// DataMessage
+
+// repeated .tcp_io_device.ProtoVariable variables = 1;
+inline int DataMessage::_internal_variables_size() const {
+  return _impl_.variables_.size();
+}
+inline int DataMessage::variables_size() const {
+  return _internal_variables_size();
+}
+inline void DataMessage::clear_variables() {
+  _impl_.variables_.Clear();
+}
+inline ::tcp_io_device::ProtoVariable* DataMessage::mutable_variables(int index) {
+  // @@protoc_insertion_point(field_mutable:tcp_io_device.DataMessage.variables)
+  return _impl_.variables_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tcp_io_device::ProtoVariable >*
+DataMessage::mutable_variables() {
+  // @@protoc_insertion_point(field_mutable_list:tcp_io_device.DataMessage.variables)
+  return &_impl_.variables_;
+}
+inline const ::tcp_io_device::ProtoVariable& DataMessage::_internal_variables(int index) const {
+  return _impl_.variables_.Get(index);
+}
+inline const ::tcp_io_device::ProtoVariable& DataMessage::variables(int index) const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.DataMessage.variables)
+  return _internal_variables(index);
+}
+inline ::tcp_io_device::ProtoVariable* DataMessage::_internal_add_variables() {
+  return _impl_.variables_.Add();
+}
+inline ::tcp_io_device::ProtoVariable* DataMessage::add_variables() {
+  ::tcp_io_device::ProtoVariable* _add = _internal_add_variables();
+  // @@protoc_insertion_point(field_add:tcp_io_device.DataMessage.variables)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tcp_io_device::ProtoVariable >&
+DataMessage::variables() const {
+  // @@protoc_insertion_point(field_list:tcp_io_device.DataMessage.variables)
+  return _impl_.variables_;
+}
+
+// uint64 timeSpan = 2;
+inline void DataMessage::clear_timespan() {
+  _impl_.timespan_ = uint64_t{0u};
+}
+inline uint64_t DataMessage::_internal_timespan() const {
+  return _impl_.timespan_;
+}
+inline uint64_t DataMessage::timespan() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.DataMessage.timeSpan)
+  return _internal_timespan();
+}
+inline void DataMessage::_internal_set_timespan(uint64_t value) {
+  
+  _impl_.timespan_ = value;
+}
+inline void DataMessage::set_timespan(uint64_t value) {
+  _internal_set_timespan(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.DataMessage.timeSpan)
+}
+
+// -------------------------------------------------------------------
+
+// BatchMessage
+
+// repeated .tcp_io_device.DataMessage dataMessages = 1;
+inline int BatchMessage::_internal_datamessages_size() const {
+  return _impl_.datamessages_.size();
+}
+inline int BatchMessage::datamessages_size() const {
+  return _internal_datamessages_size();
+}
+inline void BatchMessage::clear_datamessages() {
+  _impl_.datamessages_.Clear();
+}
+inline ::tcp_io_device::DataMessage* BatchMessage::mutable_datamessages(int index) {
+  // @@protoc_insertion_point(field_mutable:tcp_io_device.BatchMessage.dataMessages)
+  return _impl_.datamessages_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tcp_io_device::DataMessage >*
+BatchMessage::mutable_datamessages() {
+  // @@protoc_insertion_point(field_mutable_list:tcp_io_device.BatchMessage.dataMessages)
+  return &_impl_.datamessages_;
+}
+inline const ::tcp_io_device::DataMessage& BatchMessage::_internal_datamessages(int index) const {
+  return _impl_.datamessages_.Get(index);
+}
+inline const ::tcp_io_device::DataMessage& BatchMessage::datamessages(int index) const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.BatchMessage.dataMessages)
+  return _internal_datamessages(index);
+}
+inline ::tcp_io_device::DataMessage* BatchMessage::_internal_add_datamessages() {
+  return _impl_.datamessages_.Add();
+}
+inline ::tcp_io_device::DataMessage* BatchMessage::add_datamessages() {
+  ::tcp_io_device::DataMessage* _add = _internal_add_datamessages();
+  // @@protoc_insertion_point(field_add:tcp_io_device.BatchMessage.dataMessages)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tcp_io_device::DataMessage >&
+BatchMessage::datamessages() const {
+  // @@protoc_insertion_point(field_list:tcp_io_device.BatchMessage.dataMessages)
+  return _impl_.datamessages_;
+}
+
+// repeated uint64 timestamps = 2;
+inline int BatchMessage::_internal_timestamps_size() const {
+  return _impl_.timestamps_.size();
+}
+inline int BatchMessage::timestamps_size() const {
+  return _internal_timestamps_size();
+}
+inline void BatchMessage::clear_timestamps() {
+  _impl_.timestamps_.Clear();
+}
+inline uint64_t BatchMessage::_internal_timestamps(int index) const {
+  return _impl_.timestamps_.Get(index);
+}
+inline uint64_t BatchMessage::timestamps(int index) const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.BatchMessage.timestamps)
+  return _internal_timestamps(index);
+}
+inline void BatchMessage::set_timestamps(int index, uint64_t value) {
+  _impl_.timestamps_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.BatchMessage.timestamps)
+}
+inline void BatchMessage::_internal_add_timestamps(uint64_t value) {
+  _impl_.timestamps_.Add(value);
+}
+inline void BatchMessage::add_timestamps(uint64_t value) {
+  _internal_add_timestamps(value);
+  // @@protoc_insertion_point(field_add:tcp_io_device.BatchMessage.timestamps)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+BatchMessage::_internal_timestamps() const {
+  return _impl_.timestamps_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+BatchMessage::timestamps() const {
+  // @@protoc_insertion_point(field_list:tcp_io_device.BatchMessage.timestamps)
+  return _internal_timestamps();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+BatchMessage::_internal_mutable_timestamps() {
+  return &_impl_.timestamps_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+BatchMessage::mutable_timestamps() {
+  // @@protoc_insertion_point(field_mutable_list:tcp_io_device.BatchMessage.timestamps)
+  return _internal_mutable_timestamps();
+}
+
+// -------------------------------------------------------------------
+
+// SubscriptionMessage
+
+// repeated .tcp_io_device.Subscription subscriptions = 1;
+inline int SubscriptionMessage::_internal_subscriptions_size() const {
+  return _impl_.subscriptions_.size();
+}
+inline int SubscriptionMessage::subscriptions_size() const {
+  return _internal_subscriptions_size();
+}
+inline void SubscriptionMessage::clear_subscriptions() {
+  _impl_.subscriptions_.Clear();
+}
+inline ::tcp_io_device::Subscription* SubscriptionMessage::mutable_subscriptions(int index) {
+  // @@protoc_insertion_point(field_mutable:tcp_io_device.SubscriptionMessage.subscriptions)
+  return _impl_.subscriptions_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tcp_io_device::Subscription >*
+SubscriptionMessage::mutable_subscriptions() {
+  // @@protoc_insertion_point(field_mutable_list:tcp_io_device.SubscriptionMessage.subscriptions)
+  return &_impl_.subscriptions_;
+}
+inline const ::tcp_io_device::Subscription& SubscriptionMessage::_internal_subscriptions(int index) const {
+  return _impl_.subscriptions_.Get(index);
+}
+inline const ::tcp_io_device::Subscription& SubscriptionMessage::subscriptions(int index) const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.SubscriptionMessage.subscriptions)
+  return _internal_subscriptions(index);
+}
+inline ::tcp_io_device::Subscription* SubscriptionMessage::_internal_add_subscriptions() {
+  return _impl_.subscriptions_.Add();
+}
+inline ::tcp_io_device::Subscription* SubscriptionMessage::add_subscriptions() {
+  ::tcp_io_device::Subscription* _add = _internal_add_subscriptions();
+  // @@protoc_insertion_point(field_add:tcp_io_device.SubscriptionMessage.subscriptions)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tcp_io_device::Subscription >&
+SubscriptionMessage::subscriptions() const {
+  // @@protoc_insertion_point(field_list:tcp_io_device.SubscriptionMessage.subscriptions)
+  return _impl_.subscriptions_;
+}
+
+// bool includeOthers = 2;
+inline void SubscriptionMessage::clear_includeothers() {
+  _impl_.includeothers_ = false;
+}
+inline bool SubscriptionMessage::_internal_includeothers() const {
+  return _impl_.includeothers_;
+}
+inline bool SubscriptionMessage::includeothers() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.SubscriptionMessage.includeOthers)
+  return _internal_includeothers();
+}
+inline void SubscriptionMessage::_internal_set_includeothers(bool value) {
+  
+  _impl_.includeothers_ = value;
+}
+inline void SubscriptionMessage::set_includeothers(bool value) {
+  _internal_set_includeothers(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.SubscriptionMessage.includeOthers)
+}
+
+// -------------------------------------------------------------------
+
+// Subscription
+
+// int32 entityID = 1;
+inline void Subscription::clear_entityid() {
+  _impl_.entityid_ = 0;
+}
+inline int32_t Subscription::_internal_entityid() const {
+  return _impl_.entityid_;
+}
+inline int32_t Subscription::entityid() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.Subscription.entityID)
+  return _internal_entityid();
+}
+inline void Subscription::_internal_set_entityid(int32_t value) {
+  
+  _impl_.entityid_ = value;
+}
+inline void Subscription::set_entityid(int32_t value) {
+  _internal_set_entityid(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.Subscription.entityID)
+}
+
+// int32 ID = 2;
+inline void Subscription::clear_id() {
+  _impl_.id_ = 0;
+}
+inline int32_t Subscription::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t Subscription::id() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.Subscription.ID)
+  return _internal_id();
+}
+inline void Subscription::_internal_set_id(int32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void Subscription::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.Subscription.ID)
+}
+
+// uint32 decimation = 3;
+inline void Subscription::clear_decimation() {
+  _impl_.decimation_ = 0u;
+}
+inline uint32_t Subscription::_internal_decimation() const {
+  return _impl_.decimation_;
+}
+inline uint32_t Subscription::decimation() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.Subscription.decimation)
+  return _internal_decimation();
+}
+inline void Subscription::_internal_set_decimation(uint32_t value) {
+  
+  _impl_.decimation_ = value;
+}
+inline void Subscription::set_decimation(uint32_t value) {
+  _internal_set_decimation(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.Subscription.decimation)
+}
+
+// uint64 minInterval = 4;
+inline void Subscription::clear_mininterval() {
+  _impl_.mininterval_ = uint64_t{0u};
+}
+inline uint64_t Subscription::_internal_mininterval() const {
+  return _impl_.mininterval_;
+}
+inline uint64_t Subscription::mininterval() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.Subscription.minInterval)
+  return _internal_mininterval();
 }
-inline std::string* CommandDescription::release_name() {
-  // @@protoc_insertion_point(field_release:tcp_io_device.CommandDescription.name)
-  return _impl_.name_.Release();
+inline void Subscription::_internal_set_mininterval(uint64_t value) {
+  
+  _impl_.mininterval_ = value;
 }
-inline void CommandDescription::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:tcp_io_device.CommandDescription.name)
+inline void Subscription::set_mininterval(uint64_t value) {
+  _internal_set_mininterval(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.Subscription.minInterval)
 }
 
-// -------------------------------------------------------------------
-
-// DataMessage
-
-// repeated .tcp_io_device.ProtoVariable variables = 1;
-inline int DataMessage::_internal_variables_size() const {
-  return _impl_.variables_.size();
+// bool changeOnly = 5;
+inline void Subscription::clear_changeonly() {
+  _impl_.changeonly_ = false;
 }
-inline int DataMessage::variables_size() const {
-  return _internal_variables_size();
+inline bool Subscription::_internal_changeonly() const {
+  return _impl_.changeonly_;
 }
-inline void DataMessage::clear_variables() {
-  _impl_.variables_.Clear();
+inline bool Subscription::changeonly() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.Subscription.changeOnly)
+  return _internal_changeonly();
 }
-inline ::tcp_io_device::ProtoVariable* DataMessage::mutable_variables(int index) {
-  // @@protoc_insertion_point(field_mutable:tcp_io_device.DataMessage.variables)
-  return _impl_.variables_.Mutable(index);
+inline void Subscription::_internal_set_changeonly(bool value) {
+  
+  _impl_.changeonly_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tcp_io_device::ProtoVariable >*
-DataMessage::mutable_variables() {
-  // @@protoc_insertion_point(field_mutable_list:tcp_io_device.DataMessage.variables)
-  return &_impl_.variables_;
+inline void Subscription::set_changeonly(bool value) {
+  _internal_set_changeonly(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.Subscription.changeOnly)
 }
-inline const ::tcp_io_device::ProtoVariable& DataMessage::_internal_variables(int index) const {
-  return _impl_.variables_.Get(index);
+
+// double deadBand = 6;
+inline void Subscription::clear_deadband() {
+  _impl_.deadband_ = 0;
 }
-inline const ::tcp_io_device::ProtoVariable& DataMessage::variables(int index) const {
-  // @@protoc_insertion_point(field_get:tcp_io_device.DataMessage.variables)
-  return _internal_variables(index);
+inline double Subscription::_internal_deadband() const {
+  return _impl_.deadband_;
 }
-inline ::tcp_io_device::ProtoVariable* DataMessage::_internal_add_variables() {
-  return _impl_.variables_.Add();
+inline double Subscription::deadband() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.Subscription.deadBand)
+  return _internal_deadband();
 }
-inline ::tcp_io_device::ProtoVariable* DataMessage::add_variables() {
-  ::tcp_io_device::ProtoVariable* _add = _internal_add_variables();
-  // @@protoc_insertion_point(field_add:tcp_io_device.DataMessage.variables)
-  return _add;
+inline void Subscription::_internal_set_deadband(double value) {
+  
+  _impl_.deadband_ = value;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tcp_io_device::ProtoVariable >&
-DataMessage::variables() const {
-  // @@protoc_insertion_point(field_list:tcp_io_device.DataMessage.variables)
-  return _impl_.variables_;
+inline void Subscription::set_deadband(double value) {
+  _internal_set_deadband(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.Subscription.deadBand)
 }
 
-// uint64 timeSpan = 2;
-inline void DataMessage::clear_timespan() {
-  _impl_.timespan_ = uint64_t{0u};
+// uint64 maxInterval = 7;
+inline void Subscription::clear_maxinterval() {
+  _impl_.maxinterval_ = uint64_t{0u};
 }
-inline uint64_t DataMessage::_internal_timespan() const {
-  return _impl_.timespan_;
+inline uint64_t Subscription::_internal_maxinterval() const {
+  return _impl_.maxinterval_;
 }
-inline uint64_t DataMessage::timespan() const {
-  // @@protoc_insertion_point(field_get:tcp_io_device.DataMessage.timeSpan)
-  return _internal_timespan();
+inline uint64_t Subscription::maxinterval() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.Subscription.maxInterval)
+  return _internal_maxinterval();
 }
-inline void DataMessage::_internal_set_timespan(uint64_t value) {
+inline void Subscription::_internal_set_maxinterval(uint64_t value) {
   
-  _impl_.timespan_ = value;
+  _impl_.maxinterval_ = value;
 }
-inline void DataMessage::set_timespan(uint64_t value) {
-  _internal_set_timespan(value);
-  // @@protoc_insertion_point(field_set:tcp_io_device.DataMessage.timeSpan)
+inline void Subscription::set_maxinterval(uint64_t value) {
+  _internal_set_maxinterval(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.Subscription.maxInterval)
 }
 
 // -------------------------------------------------------------------
@@ -2769,6 +4754,66 @@ inline void VariableDescription::set_allocated_opcode_string_handle(std::string*
   // @@protoc_insertion_point(field_set_allocated:tcp_io_device.VariableDescription.opcode_string_handle)
 }
 
+// .tcp_io_device.VariableDescription.Encoding encoding = 6;
+inline void VariableDescription::clear_encoding() {
+  _impl_.encoding_ = 0;
+}
+inline ::tcp_io_device::VariableDescription_Encoding VariableDescription::_internal_encoding() const {
+  return static_cast< ::tcp_io_device::VariableDescription_Encoding >(_impl_.encoding_);
+}
+inline ::tcp_io_device::VariableDescription_Encoding VariableDescription::encoding() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.VariableDescription.encoding)
+  return _internal_encoding();
+}
+inline void VariableDescription::_internal_set_encoding(::tcp_io_device::VariableDescription_Encoding value) {
+  
+  _impl_.encoding_ = value;
+}
+inline void VariableDescription::set_encoding(::tcp_io_device::VariableDescription_Encoding value) {
+  _internal_set_encoding(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.VariableDescription.encoding)
+}
+
+// double scale = 7;
+inline void VariableDescription::clear_scale() {
+  _impl_.scale_ = 0;
+}
+inline double VariableDescription::_internal_scale() const {
+  return _impl_.scale_;
+}
+inline double VariableDescription::scale() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.VariableDescription.scale)
+  return _internal_scale();
+}
+inline void VariableDescription::_internal_set_scale(double value) {
+  
+  _impl_.scale_ = value;
+}
+inline void VariableDescription::set_scale(double value) {
+  _internal_set_scale(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.VariableDescription.scale)
+}
+
+// double offset = 8;
+inline void VariableDescription::clear_offset() {
+  _impl_.offset_ = 0;
+}
+inline double VariableDescription::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline double VariableDescription::offset() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.VariableDescription.offset)
+  return _internal_offset();
+}
+inline void VariableDescription::_internal_set_offset(double value) {
+  
+  _impl_.offset_ = value;
+}
+inline void VariableDescription::set_offset(double value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.VariableDescription.offset)
+}
+
 // -------------------------------------------------------------------
 
 // ProtoVariable
@@ -2913,6 +4958,479 @@ inline void ProtoVariable::set_allocated_data(std::string* data) {
   // @@protoc_insertion_point(field_set_allocated:tcp_io_device.ProtoVariable.data)
 }
 
+// repeated double doubleData = 3;
+inline int ProtoVariable::_internal_doubledata_size() const {
+  return _impl_.doubledata_.size();
+}
+inline int ProtoVariable::doubledata_size() const {
+  return _internal_doubledata_size();
+}
+inline void ProtoVariable::clear_doubledata() {
+  _impl_.doubledata_.Clear();
+}
+inline double ProtoVariable::_internal_doubledata(int index) const {
+  return _impl_.doubledata_.Get(index);
+}
+inline double ProtoVariable::doubledata(int index) const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.ProtoVariable.doubleData)
+  return _internal_doubledata(index);
+}
+inline void ProtoVariable::set_doubledata(int index, double value) {
+  _impl_.doubledata_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.ProtoVariable.doubleData)
+}
+inline void ProtoVariable::_internal_add_doubledata(double value) {
+  _impl_.doubledata_.Add(value);
+}
+inline void ProtoVariable::add_doubledata(double value) {
+  _internal_add_doubledata(value);
+  // @@protoc_insertion_point(field_add:tcp_io_device.ProtoVariable.doubleData)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+ProtoVariable::_internal_doubledata() const {
+  return _impl_.doubledata_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+ProtoVariable::doubledata() const {
+  // @@protoc_insertion_point(field_list:tcp_io_device.ProtoVariable.doubleData)
+  return _internal_doubledata();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+ProtoVariable::_internal_mutable_doubledata() {
+  return &_impl_.doubledata_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+ProtoVariable::mutable_doubledata() {
+  // @@protoc_insertion_point(field_mutable_list:tcp_io_device.ProtoVariable.doubleData)
+  return _internal_mutable_doubledata();
+}
+
+// repeated sint64 int64Data = 4;
+inline int ProtoVariable::_internal_int64data_size() const {
+  return _impl_.int64data_.size();
+}
+inline int ProtoVariable::int64data_size() const {
+  return _internal_int64data_size();
+}
+inline void ProtoVariable::clear_int64data() {
+  _impl_.int64data_.Clear();
+}
+inline int64_t ProtoVariable::_internal_int64data(int index) const {
+  return _impl_.int64data_.Get(index);
+}
+inline int64_t ProtoVariable::int64data(int index) const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.ProtoVariable.int64Data)
+  return _internal_int64data(index);
+}
+inline void ProtoVariable::set_int64data(int index, int64_t value) {
+  _impl_.int64data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.ProtoVariable.int64Data)
+}
+inline void ProtoVariable::_internal_add_int64data(int64_t value) {
+  _impl_.int64data_.Add(value);
+}
+inline void ProtoVariable::add_int64data(int64_t value) {
+  _internal_add_int64data(value);
+  // @@protoc_insertion_point(field_add:tcp_io_device.ProtoVariable.int64Data)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+ProtoVariable::_internal_int64data() const {
+  return _impl_.int64data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+ProtoVariable::int64data() const {
+  // @@protoc_insertion_point(field_list:tcp_io_device.ProtoVariable.int64Data)
+  return _internal_int64data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+ProtoVariable::_internal_mutable_int64data() {
+  return &_impl_.int64data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+ProtoVariable::mutable_int64data() {
+  // @@protoc_insertion_point(field_mutable_list:tcp_io_device.ProtoVariable.int64Data)
+  return _internal_mutable_int64data();
+}
+
+// repeated bool boolData = 5;
+inline int ProtoVariable::_internal_booldata_size() const {
+  return _impl_.booldata_.size();
+}
+inline int ProtoVariable::booldata_size() const {
+  return _internal_booldata_size();
+}
+inline void ProtoVariable::clear_booldata() {
+  _impl_.booldata_.Clear();
+}
+inline bool ProtoVariable::_internal_booldata(int index) const {
+  return _impl_.booldata_.Get(index);
+}
+inline bool ProtoVariable::booldata(int index) const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.ProtoVariable.boolData)
+  return _internal_booldata(index);
+}
+inline void ProtoVariable::set_booldata(int index, bool value) {
+  _impl_.booldata_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.ProtoVariable.boolData)
+}
+inline void ProtoVariable::_internal_add_booldata(bool value) {
+  _impl_.booldata_.Add(value);
+}
+inline void ProtoVariable::add_booldata(bool value) {
+  _internal_add_booldata(value);
+  // @@protoc_insertion_point(field_add:tcp_io_device.ProtoVariable.boolData)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+ProtoVariable::_internal_booldata() const {
+  return _impl_.booldata_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+ProtoVariable::booldata() const {
+  // @@protoc_insertion_point(field_list:tcp_io_device.ProtoVariable.boolData)
+  return _internal_booldata();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+ProtoVariable::_internal_mutable_booldata() {
+  return &_impl_.booldata_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+ProtoVariable::mutable_booldata() {
+  // @@protoc_insertion_point(field_mutable_list:tcp_io_device.ProtoVariable.boolData)
+  return _internal_mutable_booldata();
+}
+
+// repeated float floatData = 6;
+inline int ProtoVariable::_internal_floatdata_size() const {
+  return _impl_.floatdata_.size();
+}
+inline int ProtoVariable::floatdata_size() const {
+  return _internal_floatdata_size();
+}
+inline void ProtoVariable::clear_floatdata() {
+  _impl_.floatdata_.Clear();
+}
+inline float ProtoVariable::_internal_floatdata(int index) const {
+  return _impl_.floatdata_.Get(index);
+}
+inline float ProtoVariable::floatdata(int index) const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.ProtoVariable.floatData)
+  return _internal_floatdata(index);
+}
+inline void ProtoVariable::set_floatdata(int index, float value) {
+  _impl_.floatdata_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.ProtoVariable.floatData)
+}
+inline void ProtoVariable::_internal_add_floatdata(float value) {
+  _impl_.floatdata_.Add(value);
+}
+inline void ProtoVariable::add_floatdata(float value) {
+  _internal_add_floatdata(value);
+  // @@protoc_insertion_point(field_add:tcp_io_device.ProtoVariable.floatData)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+ProtoVariable::_internal_floatdata() const {
+  return _impl_.floatdata_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+ProtoVariable::floatdata() const {
+  // @@protoc_insertion_point(field_list:tcp_io_device.ProtoVariable.floatData)
+  return _internal_floatdata();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+ProtoVariable::_internal_mutable_floatdata() {
+  return &_impl_.floatdata_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+ProtoVariable::mutable_floatdata() {
+  // @@protoc_insertion_point(field_mutable_list:tcp_io_device.ProtoVariable.floatData)
+  return _internal_mutable_floatdata();
+}
+
+// repeated sint32 int32Data = 7;
+inline int ProtoVariable::_internal_int32data_size() const {
+  return _impl_.int32data_.size();
+}
+inline int ProtoVariable::int32data_size() const {
+  return _internal_int32data_size();
+}
+inline void ProtoVariable::clear_int32data() {
+  _impl_.int32data_.Clear();
+}
+inline int32_t ProtoVariable::_internal_int32data(int index) const {
+  return _impl_.int32data_.Get(index);
+}
+inline int32_t ProtoVariable::int32data(int index) const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.ProtoVariable.int32Data)
+  return _internal_int32data(index);
+}
+inline void ProtoVariable::set_int32data(int index, int32_t value) {
+  _impl_.int32data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.ProtoVariable.int32Data)
+}
+inline void ProtoVariable::_internal_add_int32data(int32_t value) {
+  _impl_.int32data_.Add(value);
+}
+inline void ProtoVariable::add_int32data(int32_t value) {
+  _internal_add_int32data(value);
+  // @@protoc_insertion_point(field_add:tcp_io_device.ProtoVariable.int32Data)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+ProtoVariable::_internal_int32data() const {
+  return _impl_.int32data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+ProtoVariable::int32data() const {
+  // @@protoc_insertion_point(field_list:tcp_io_device.ProtoVariable.int32Data)
+  return _internal_int32data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+ProtoVariable::_internal_mutable_int32data() {
+  return &_impl_.int32data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+ProtoVariable::mutable_int32data() {
+  // @@protoc_insertion_point(field_mutable_list:tcp_io_device.ProtoVariable.int32Data)
+  return _internal_mutable_int32data();
+}
+
+// repeated uint32 uint32Data = 8;
+inline int ProtoVariable::_internal_uint32data_size() const {
+  return _impl_.uint32data_.size();
+}
+inline int ProtoVariable::uint32data_size() const {
+  return _internal_uint32data_size();
+}
+inline void ProtoVariable::clear_uint32data() {
+  _impl_.uint32data_.Clear();
+}
+inline uint32_t ProtoVariable::_internal_uint32data(int index) const {
+  return _impl_.uint32data_.Get(index);
+}
+inline uint32_t ProtoVariable::uint32data(int index) const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.ProtoVariable.uint32Data)
+  return _internal_uint32data(index);
+}
+inline void ProtoVariable::set_uint32data(int index, uint32_t value) {
+  _impl_.uint32data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.ProtoVariable.uint32Data)
+}
+inline void ProtoVariable::_internal_add_uint32data(uint32_t value) {
+  _impl_.uint32data_.Add(value);
+}
+inline void ProtoVariable::add_uint32data(uint32_t value) {
+  _internal_add_uint32data(value);
+  // @@protoc_insertion_point(field_add:tcp_io_device.ProtoVariable.uint32Data)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ProtoVariable::_internal_uint32data() const {
+  return _impl_.uint32data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ProtoVariable::uint32data() const {
+  // @@protoc_insertion_point(field_list:tcp_io_device.ProtoVariable.uint32Data)
+  return _internal_uint32data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ProtoVariable::_internal_mutable_uint32data() {
+  return &_impl_.uint32data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ProtoVariable::mutable_uint32data() {
+  // @@protoc_insertion_point(field_mutable_list:tcp_io_device.ProtoVariable.uint32Data)
+  return _internal_mutable_uint32data();
+}
+
+// repeated uint64 uint64Data = 9;
+inline int ProtoVariable::_internal_uint64data_size() const {
+  return _impl_.uint64data_.size();
+}
+inline int ProtoVariable::uint64data_size() const {
+  return _internal_uint64data_size();
+}
+inline void ProtoVariable::clear_uint64data() {
+  _impl_.uint64data_.Clear();
+}
+inline uint64_t ProtoVariable::_internal_uint64data(int index) const {
+  return _impl_.uint64data_.Get(index);
+}
+inline uint64_t ProtoVariable::uint64data(int index) const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.ProtoVariable.uint64Data)
+  return _internal_uint64data(index);
+}
+inline void ProtoVariable::set_uint64data(int index, uint64_t value) {
+  _impl_.uint64data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.ProtoVariable.uint64Data)
+}
+inline void ProtoVariable::_internal_add_uint64data(uint64_t value) {
+  _impl_.uint64data_.Add(value);
+}
+inline void ProtoVariable::add_uint64data(uint64_t value) {
+  _internal_add_uint64data(value);
+  // @@protoc_insertion_point(field_add:tcp_io_device.ProtoVariable.uint64Data)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ProtoVariable::_internal_uint64data() const {
+  return _impl_.uint64data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ProtoVariable::uint64data() const {
+  // @@protoc_insertion_point(field_list:tcp_io_device.ProtoVariable.uint64Data)
+  return _internal_uint64data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ProtoVariable::_internal_mutable_uint64data() {
+  return &_impl_.uint64data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ProtoVariable::mutable_uint64data() {
+  // @@protoc_insertion_point(field_mutable_list:tcp_io_device.ProtoVariable.uint64Data)
+  return _internal_mutable_uint64data();
+}
+
+// repeated uint64 sparseIndices = 10;
+inline int ProtoVariable::_internal_sparseindices_size() const {
+  return _impl_.sparseindices_.size();
+}
+inline int ProtoVariable::sparseindices_size() const {
+  return _internal_sparseindices_size();
+}
+inline void ProtoVariable::clear_sparseindices() {
+  _impl_.sparseindices_.Clear();
+}
+inline uint64_t ProtoVariable::_internal_sparseindices(int index) const {
+  return _impl_.sparseindices_.Get(index);
+}
+inline uint64_t ProtoVariable::sparseindices(int index) const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.ProtoVariable.sparseIndices)
+  return _internal_sparseindices(index);
+}
+inline void ProtoVariable::set_sparseindices(int index, uint64_t value) {
+  _impl_.sparseindices_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.ProtoVariable.sparseIndices)
+}
+inline void ProtoVariable::_internal_add_sparseindices(uint64_t value) {
+  _impl_.sparseindices_.Add(value);
+}
+inline void ProtoVariable::add_sparseindices(uint64_t value) {
+  _internal_add_sparseindices(value);
+  // @@protoc_insertion_point(field_add:tcp_io_device.ProtoVariable.sparseIndices)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ProtoVariable::_internal_sparseindices() const {
+  return _impl_.sparseindices_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ProtoVariable::sparseindices() const {
+  // @@protoc_insertion_point(field_list:tcp_io_device.ProtoVariable.sparseIndices)
+  return _internal_sparseindices();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ProtoVariable::_internal_mutable_sparseindices() {
+  return &_impl_.sparseindices_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ProtoVariable::mutable_sparseindices() {
+  // @@protoc_insertion_point(field_mutable_list:tcp_io_device.ProtoVariable.sparseIndices)
+  return _internal_mutable_sparseindices();
+}
+
+// bytes sparseBitmap = 11;
+inline void ProtoVariable::clear_sparsebitmap() {
+  _impl_.sparsebitmap_.ClearToEmpty();
+}
+inline const std::string& ProtoVariable::sparsebitmap() const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.ProtoVariable.sparseBitmap)
+  return _internal_sparsebitmap();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ProtoVariable::set_sparsebitmap(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.sparsebitmap_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tcp_io_device.ProtoVariable.sparseBitmap)
+}
+inline std::string* ProtoVariable::mutable_sparsebitmap() {
+  std::string* _s = _internal_mutable_sparsebitmap();
+  // @@protoc_insertion_point(field_mutable:tcp_io_device.ProtoVariable.sparseBitmap)
+  return _s;
+}
+inline const std::string& ProtoVariable::_internal_sparsebitmap() const {
+  return _impl_.sparsebitmap_.Get();
+}
+inline void ProtoVariable::_internal_set_sparsebitmap(const std::string& value) {
+  
+  _impl_.sparsebitmap_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ProtoVariable::_internal_mutable_sparsebitmap() {
+  
+  return _impl_.sparsebitmap_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ProtoVariable::release_sparsebitmap() {
+  // @@protoc_insertion_point(field_release:tcp_io_device.ProtoVariable.sparseBitmap)
+  return _impl_.sparsebitmap_.Release();
+}
+inline void ProtoVariable::set_allocated_sparsebitmap(std::string* sparsebitmap) {
+  if (sparsebitmap != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.sparsebitmap_.SetAllocated(sparsebitmap, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sparsebitmap_.IsDefault()) {
+    _impl_.sparsebitmap_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tcp_io_device.ProtoVariable.sparseBitmap)
+}
+
+// repeated uint64 deltaRanges = 12;
+inline int ProtoVariable::_internal_deltaranges_size() const {
+  return _impl_.deltaranges_.size();
+}
+inline int ProtoVariable::deltaranges_size() const {
+  return _internal_deltaranges_size();
+}
+inline void ProtoVariable::clear_deltaranges() {
+  _impl_.deltaranges_.Clear();
+}
+inline uint64_t ProtoVariable::_internal_deltaranges(int index) const {
+  return _impl_.deltaranges_.Get(index);
+}
+inline uint64_t ProtoVariable::deltaranges(int index) const {
+  // @@protoc_insertion_point(field_get:tcp_io_device.ProtoVariable.deltaRanges)
+  return _internal_deltaranges(index);
+}
+inline void ProtoVariable::set_deltaranges(int index, uint64_t value) {
+  _impl_.deltaranges_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tcp_io_device.ProtoVariable.deltaRanges)
+}
+inline void ProtoVariable::_internal_add_deltaranges(uint64_t value) {
+  _impl_.deltaranges_.Add(value);
+}
+inline void ProtoVariable::add_deltaranges(uint64_t value) {
+  _internal_add_deltaranges(value);
+  // @@protoc_insertion_point(field_add:tcp_io_device.ProtoVariable.deltaRanges)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ProtoVariable::_internal_deltaranges() const {
+  return _impl_.deltaranges_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ProtoVariable::deltaranges() const {
+  // @@protoc_insertion_point(field_list:tcp_io_device.ProtoVariable.deltaRanges)
+  return _internal_deltaranges();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ProtoVariable::_internal_mutable_deltaranges() {
+  return &_impl_.deltaranges_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ProtoVariable::mutable_deltaranges() {
+  // @@protoc_insertion_point(field_mutable_list:tcp_io_device.ProtoVariable.deltaRanges)
+  return _internal_mutable_deltaranges();
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -2936,6 +5454,12 @@ inline void ProtoVariable::set_allocated_data(std::string* data) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -2948,16 +5472,36 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::tcp_io_device::TCPMessage_Type>() {
   return ::tcp_io_device::TCPMessage_Type_descriptor();
 }
+template <> struct is_proto_enum< ::tcp_io_device::TCPMessage_ByteOrder> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::tcp_io_device::TCPMessage_ByteOrder>() {
+  return ::tcp_io_device::TCPMessage_ByteOrder_descriptor();
+}
 template <> struct is_proto_enum< ::tcp_io_device::StartMessage_ReconnectionType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::tcp_io_device::StartMessage_ReconnectionType>() {
   return ::tcp_io_device::StartMessage_ReconnectionType_descriptor();
 }
+template <> struct is_proto_enum< ::tcp_io_device::StartMessage_Compression> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::tcp_io_device::StartMessage_Compression>() {
+  return ::tcp_io_device::StartMessage_Compression_descriptor();
+}
+template <> struct is_proto_enum< ::tcp_io_device::StartMessage_Framing> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::tcp_io_device::StartMessage_Framing>() {
+  return ::tcp_io_device::StartMessage_Framing_descriptor();
+}
 template <> struct is_proto_enum< ::tcp_io_device::VariableDescription_DataType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::tcp_io_device::VariableDescription_DataType>() {
   return ::tcp_io_device::VariableDescription_DataType_descriptor();
 }
+template <> struct is_proto_enum< ::tcp_io_device::VariableDescription_Encoding> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::tcp_io_device::VariableDescription_Encoding>() {
+  return ::tcp_io_device::VariableDescription_Encoding_descriptor();
+}
 
 PROTOBUF_NAMESPACE_CLOSE
 
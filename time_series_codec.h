@@ -0,0 +1,402 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021-2025 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+#pragma once
+
+#include <unordered_map>
+#include "utils.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace tcp_io_device {
+
+  /**
+  * Writes bit fields, most significant bit first, into a byte string.
+  */
+  class BitWriter {
+  public:
+    BitWriter(std::string& out) : out_(out) {}
+
+    /**
+    * Appends the lowest bits of value.
+    */
+    void write(uint64_t value, int bits) {
+      while (bits > 0) {
+        int n = std::min(bits, 64 - fill_);
+        uint64_t part = (value >> (bits - n)) & lowMask(n);
+        acc_ = n == 64 ? part : (acc_ << n) | part;
+        fill_ += n;
+        bits -= n;
+        if (fill_ == 64) {
+          flush(8);
+        }
+      }
+    }
+
+    /**
+    * Writes the remaining bits, padded with zeros to a full byte.
+    */
+    void finish() {
+      if (fill_ > 0) {
+        acc_ <<= 64 - fill_;
+        flush((fill_ + 7) / 8);
+      }
+    }
+
+    static uint64_t lowMask(int bits) { return bits >= 64 ? ~(uint64_t)0 : (((uint64_t)1 << bits) - 1); }
+
+  private:
+    void flush(int bytes) {
+      for (int i = 0; i < bytes; ++i) {
+        out_ += (char)(acc_ >> (56 - 8 * i));
+      }
+      acc_ = 0;
+      fill_ = 0;
+    }
+
+    std::string& out_;
+    uint64_t acc_ = 0;
+    int fill_ = 0;
+  };
+
+  /**
+  * Reads bit fields written by a BitWriter. Reading past the end returns zeros and sets overrun().
+  */
+  class BitReader {
+  public:
+    BitReader(const std::string& in) : in_(in) {}
+
+    uint64_t read(int bits) {
+      uint64_t result = 0;
+      while (bits > 0) {
+        if (avail_ == 0 && !refill()) {
+          overrun_ = true;
+          return result;
+        }
+        int n = std::min(bits, avail_);
+        uint64_t part = acc_ >> (64 - n);
+        acc_ = n == 64 ? 0 : acc_ << n;
+        avail_ -= n;
+        result = n == 64 ? part : (result << n) | part;
+        bits -= n;
+      }
+      return result;
+    }
+
+    bool overrun() const { return overrun_; }
+
+  private:
+    bool refill() {
+      size_t bytes = std::min<size_t>(8, in_.size() - pos_);
+      if (bytes == 0) {
+        return false;
+      }
+      acc_ = 0;
+      for (size_t i = 0; i < bytes; ++i) {
+        acc_ |= (uint64_t)(uint8_t)in_[pos_ + i] << (56 - 8 * i);
+      }
+      pos_ += bytes;
+      avail_ = (int)bytes * 8;
+      return true;
+    }
+
+    const std::string& in_;
+    size_t pos_ = 0;
+    uint64_t acc_ = 0;
+    int avail_ = 0;
+    bool overrun_ = false;
+  };
+
+  /**
+  * Stateful codec for slowly changing DOUBLE, INT64 and COMMUNICATION_ID variables, used by the TCPConnection once it
+  * is negotiated in the StartMessage. Every value is coded against the value of the same element in the previous frame
+  * of the same (entityID, ID):
+  * - DOUBLE (GORILLA): The XOR with the previous value is written as in Facebook's Gorilla: a single 0 bit if
+  *   unchanged, otherwise the meaningful bits, reusing the leading/trailing zero window of the previous value if it fits.
+  * - INT64, COMMUNICATION_ID (DELTA_VARINT): The difference to the previous value, zigzag and varint coded.
+  * Encoder and decoder need to see the same sequence of frames, so the state is reset whenever the connection is
+  * re-established. The RAW data exchanged with MsgData stays in the byte order of the sender.
+  */
+  class TimeSeriesCodec {
+  public:
+    /**
+    * Forgets the previous values of all variables.
+    */
+    void reset() { states_.clear(); }
+
+    /**
+    * Encodes all RAW DOUBLE, INT64 and COMMUNICATION_ID variables of the DataMessage in place.
+    */
+    void encode(DataMessage* msg) {
+      for (int i = 0; i < msg->variables_size(); ++i) {
+        encode(msg->mutable_variables(i));
+      }
+    }
+
+    /**
+    * Decodes all GORILLA and DELTA_VARINT variables of the DataMessage in place back to RAW.
+    * \param byte_order The byte order of the sender, used for the decoded RAW data.
+    */
+    void decode(DataMessage* msg, TCPMessage_ByteOrder byte_order) {
+      for (int i = 0; i < msg->variables_size(); ++i) {
+        decode(msg->mutable_variables(i), byte_order);
+      }
+    }
+
+    void encode(ProtoVariable* var) {
+      const VariableDescription& description = var->metadata();
+      if (description.encoding() != VariableDescription_Encoding_RAW) {
+        return;
+      }
+      bool is_double = description.datatype() == VariableDescription_DataType_DOUBLE;
+      bool is_int64 = description.datatype() == VariableDescription_DataType_INT64 ||
+        description.datatype() == VariableDescription_DataType_COMMUNICATION_ID;
+      size_t count = var->data().size() / sizeof(uint64_t);
+      if ((!is_double && !is_int64) || var->data().size() != count * sizeof(uint64_t) || count != elementCount(description)) {
+        return;
+      }
+      std::vector<uint64_t> values(count);
+      if (count > 0) {
+        memcpy(values.data(), var->data().data(), count * sizeof(uint64_t));
+      }
+      VariableState& state = stateFor(description, count);
+      std::string out;
+      if (is_double) {
+        encodeXor(values, state, out);
+        var->mutable_metadata()->set_encoding(VariableDescription_Encoding_GORILLA);
+      }
+      else {
+        encodeDelta(values, state, out);
+        var->mutable_metadata()->set_encoding(VariableDescription_Encoding_DELTA_VARINT);
+      }
+      var->set_data(out);
+    }
+
+    void decode(ProtoVariable* var, TCPMessage_ByteOrder byte_order) {
+      const VariableDescription& description = var->metadata();
+      bool is_xor = description.encoding() == VariableDescription_Encoding_GORILLA;
+      if (!is_xor && description.encoding() != VariableDescription_Encoding_DELTA_VARINT) {
+        return;
+      }
+      size_t count = elementCount(description);
+      VariableState& state = stateFor(description, count);
+      std::vector<uint64_t> values(count);
+      bool ok = is_xor ? decodeXor(var->data(), state, values) : decodeDelta(var->data(), state, values);
+      var->mutable_metadata()->set_encoding(VariableDescription_Encoding_RAW);
+      if (!ok) {
+        std::cout << "WARNING: Corrupt time series data of entity " << description.entityid() << " id " << description.id() << std::endl;
+        states_.erase(key(description));
+        var->clear_data();
+        return;
+      }
+      if (byte_order != hostByteOrder() && count > 0) {
+        kernels::byteSwap(values.data(), count, sizeof(uint64_t));
+      }
+      var->set_data(std::string((const char*)values.data(), count * sizeof(uint64_t)));
+    }
+
+  private:
+    struct VariableState {
+      std::vector<uint64_t> previous;
+      std::vector<uint8_t> leading;
+      std::vector<uint8_t> trailing;
+    };
+
+    static uint64_t key(const VariableDescription& description) {
+      return ((uint64_t)(uint32_t)description.entityid() << 32) | (uint32_t)description.id();
+    }
+
+    static size_t elementCount(const VariableDescription& description) {
+      size_t count = 1;
+      for (uint64_t d : description.dimensions()) {
+        count *= d;
+      }
+      return count;
+    }
+
+    VariableState& stateFor(const VariableDescription& description, size_t count) {
+      VariableState& state = states_[key(description)];
+      if (state.previous.size() != count) {
+        // New variable or changed dimensions, both sides start again from zeros.
+        state.previous.assign(count, 0);
+        state.leading.assign(count, 0xFF);
+        state.trailing.assign(count, 0);
+      }
+      return state;
+    }
+
+    static int leadingZeros(uint64_t x) {
+#if defined(_MSC_VER)
+      unsigned long index;
+      _BitScanReverse64(&index, x);
+      return 63 - (int)index;
+#else
+      return __builtin_clzll(x);
+#endif
+    }
+
+    static int trailingZeros(uint64_t x) {
+#if defined(_MSC_VER)
+      unsigned long index;
+      _BitScanForward64(&index, x);
+      return (int)index;
+#else
+      return __builtin_ctzll(x);
+#endif
+    }
+
+    static void encodeXor(const std::vector<uint64_t>& values, VariableState& state, std::string& out) {
+      BitWriter writer(out);
+      for (size_t i = 0; i < values.size(); ++i) {
+        uint64_t x = values[i] ^ state.previous[i];
+        state.previous[i] = values[i];
+        if (x == 0) {
+          writer.write(0, 1);
+          continue;
+        }
+        int leading = std::min(leadingZeros(x), 31);
+        int trailing = trailingZeros(x);
+        if (state.leading[i] != 0xFF && leading >= state.leading[i] && trailing >= state.trailing[i]) {
+          // Fits into the window of the previous value.
+          writer.write(2, 2);
+          writer.write(x >> state.trailing[i], 64 - state.leading[i] - state.trailing[i]);
+        }
+        else {
+          int meaningful = 64 - leading - trailing;
+          writer.write(3, 2);
+          writer.write(leading, 5);
+          writer.write(meaningful & 63, 6);
+          writer.write(x >> trailing, meaningful);
+          state.leading[i] = (uint8_t)leading;
+          state.trailing[i] = (uint8_t)trailing;
+        }
+      }
+      writer.finish();
+    }
+
+    static bool decodeXor(const std::string& in, VariableState& state, std::vector<uint64_t>& values) {
+      BitReader reader(in);
+      for (size_t i = 0; i < values.size(); ++i) {
+        uint64_t x = 0;
+        if (reader.read(1) != 0) {
+          if (reader.read(1) == 0) {
+            if (state.leading[i] == 0xFF) {
+              return false;
+            }
+            x = reader.read(64 - state.leading[i] - state.trailing[i]) << state.trailing[i];
+          }
+          else {
+            int leading = (int)reader.read(5);
+            int meaningful = (int)reader.read(6);
+            if (meaningful == 0) {
+              meaningful = 64;
+            }
+            int trailing = 64 - leading - meaningful;
+            if (trailing < 0) {
+              return false;
+            }
+            x = reader.read(meaningful) << trailing;
+            state.leading[i] = (uint8_t)leading;
+            state.trailing[i] = (uint8_t)trailing;
+          }
+        }
+        state.previous[i] ^= x;
+        values[i] = state.previous[i];
+      }
+      return !reader.overrun();
+    }
+
+    static void encodeDelta(const std::vector<uint64_t>& values, VariableState& state, std::string& out) {
+      for (size_t i = 0; i < values.size(); ++i) {
+        int64_t delta = (int64_t)(values[i] - state.previous[i]);
+        state.previous[i] = values[i];
+        uint64_t zigzag = ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63);
+        while (zigzag >= 0x80) {
+          out += (char)(zigzag | 0x80);
+          zigzag >>= 7;
+        }
+        out += (char)zigzag;
+      }
+    }
+
+    static bool decodeDelta(const std::string& in, VariableState& state, std::vector<uint64_t>& values) {
+      size_t pos = 0;
+      for (size_t i = 0; i < values.size(); ++i) {
+        uint64_t zigzag = 0;
+        int shift = 0;
+        while (true) {
+          if (pos >= in.size() || shift > 63) {
+            return false;
+          }
+          uint8_t byte = (uint8_t)in[pos++];
+          zigzag |= (uint64_t)(byte & 0x7F) << shift;
+          shift += 7;
+          if (!(byte & 0x80)) {
+            break;
+          }
+        }
+        int64_t delta = (int64_t)(zigzag >> 1) ^ -(int64_t)(zigzag & 1);
+        state.previous[i] += (uint64_t)delta;
+        values[i] = state.previous[i];
+      }
+      return true;
+    }
+
+    std::unordered_map<uint64_t, VariableState> states_;
+  };
+
+} // namespace tcp_io_device
@@ -56,18 +56,90 @@
 #pragma once
 
 #include <iostream>
+#include <algorithm>
+#include <vector>
 #include <iomanip>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string_view>
 #include "tcp_data_message.pb.h"
+#include "simd_kernels.h"
 
 using communication_id_t = int64_t;
 
 namespace tcp_io_device {
+
+  template <VariableDescription_DataType D, typename T>
+  struct DataTypeTraitsBase {
+    using type = T;
+    static constexpr VariableDescription_DataType data_type = D;
+    static constexpr size_t size = sizeof(T);
+    static constexpr size_t alignment = alignof(T);
+  };
+
+  /**
+  * Compile-time traits of a VariableDescription_DataType: the C++ type of a single value (type), its size and alignment.
+  * STRING and BYTES are handled as arrays of char.
+  */
+  template <VariableDescription_DataType D> struct DataTypeTraits;
+  template <> struct DataTypeTraits<VariableDescription_DataType_DOUBLE> : DataTypeTraitsBase<VariableDescription_DataType_DOUBLE, double> {};
+  template <> struct DataTypeTraits<VariableDescription_DataType_FLOAT> : DataTypeTraitsBase<VariableDescription_DataType_FLOAT, float> {};
+  template <> struct DataTypeTraits<VariableDescription_DataType_INT32> : DataTypeTraitsBase<VariableDescription_DataType_INT32, int32_t> {};
+  template <> struct DataTypeTraits<VariableDescription_DataType_INT64> : DataTypeTraitsBase<VariableDescription_DataType_INT64, int64_t> {};
+  template <> struct DataTypeTraits<VariableDescription_DataType_UINT32> : DataTypeTraitsBase<VariableDescription_DataType_UINT32, uint32_t> {};
+  template <> struct DataTypeTraits<VariableDescription_DataType_UINT64> : DataTypeTraitsBase<VariableDescription_DataType_UINT64, uint64_t> {};
+  template <> struct DataTypeTraits<VariableDescription_DataType_BOOL> : DataTypeTraitsBase<VariableDescription_DataType_BOOL, bool> {};
+  template <> struct DataTypeTraits<VariableDescription_DataType_STRING> : DataTypeTraitsBase<VariableDescription_DataType_STRING, char> {};
+  template <> struct DataTypeTraits<VariableDescription_DataType_BYTES> : DataTypeTraitsBase<VariableDescription_DataType_BYTES, char> {};
+  template <> struct DataTypeTraits<VariableDescription_DataType_COMMUNICATION_ID> : DataTypeTraitsBase<VariableDescription_DataType_COMMUNICATION_ID, communication_id_t> {};
+
+  /**
+  * Calls f with the DataTypeTraits of the passed data type, e.g. f(DataTypeTraits<VariableDescription_DataType_DOUBLE>()).
+  * Used to turn the runtime data type into a compile-time type once, so that loops inside of f are specialised for it.
+  * Unknown data types are handled as BYTES.
+  * \param t The data type to dispatch on.
+  * \param f A callable taking any DataTypeTraits, typically a generic lambda [](auto traits) {...}.
+  * \return The value returned by f.
+  */
+  template <typename F>
+  constexpr auto visit(VariableDescription_DataType t, F&& f) -> decltype(f(DataTypeTraits<VariableDescription_DataType_BYTES>())) {
+    switch (t) {
+    case VariableDescription_DataType_DOUBLE: return f(DataTypeTraits<VariableDescription_DataType_DOUBLE>());
+    case VariableDescription_DataType_FLOAT: return f(DataTypeTraits<VariableDescription_DataType_FLOAT>());
+    case VariableDescription_DataType_INT32: return f(DataTypeTraits<VariableDescription_DataType_INT32>());
+    case VariableDescription_DataType_INT64: return f(DataTypeTraits<VariableDescription_DataType_INT64>());
+    case VariableDescription_DataType_UINT32: return f(DataTypeTraits<VariableDescription_DataType_UINT32>());
+    case VariableDescription_DataType_UINT64: return f(DataTypeTraits<VariableDescription_DataType_UINT64>());
+    case VariableDescription_DataType_BOOL: return f(DataTypeTraits<VariableDescription_DataType_BOOL>());
+    case VariableDescription_DataType_STRING: return f(DataTypeTraits<VariableDescription_DataType_STRING>());
+    case VariableDescription_DataType_COMMUNICATION_ID: return f(DataTypeTraits<VariableDescription_DataType_COMMUNICATION_ID>());
+    default: return f(DataTypeTraits<VariableDescription_DataType_BYTES>());
+    }
+  }
+
+  /**
+  * Returns the number of bytes of a single value of the passed data type (e.g. 8 for DOUBLE, 1 for BYTES).
+  */
+  constexpr size_t typeSize(VariableDescription_DataType t) {
+    return visit(t, [](auto traits) { return decltype(traits)::size; });
+  }
+
+  /**
+  * Returns the byte order of the host, which is used for all numeric values stored in a MsgData.
+  */
+  inline TCPMessage_ByteOrder hostByteOrder() {
+    const uint16_t one = 1;
+    return *(const uint8_t*)&one ? TCPMessage_ByteOrder_LITTLE : TCPMessage_ByteOrder_BIG;
+  }
+
   /**
   * MetaData is a class to store the meta-data of messages. Especially used for storing of available commands and their descriptions.
   * Additionally gives access to convenience funtions, like VariableDescription message parsing.
   */
   class MetaData {
     friend class MsgData;
+    friend class WireEncoder;
 
   private:
     MetaData() {}
@@ -81,6 +153,10 @@ namespace tcp_io_device {
     uint64_t data_length_ = 0;
     std::vector<uint64_t> dimensions_;
     std::string opcode_handle_;
+    VariableDescription_Encoding encoding_ = VariableDescription_Encoding_RAW;
+    double scale_ = 0;
+    double offset_ = 0;
+    double sparse_threshold_ = 0;
 
   public:
     /**
@@ -93,6 +169,9 @@ namespace tcp_io_device {
         meta_data->datatype(),
         std::vector<uint64_t>(meta_data->dimensions().begin(), meta_data->dimensions().end()),
         meta_data->opcode_string_handle());
+      encoding_ = meta_data->encoding();
+      scale_ = meta_data->scale();
+      offset_ = meta_data->offset();
     }
 
     /**
@@ -110,14 +189,14 @@ namespace tcp_io_device {
     /**
     * Returns the id of the entity for which this description is used.
     */
-    int getEntityID() {
+    int getEntityID() const {
       return entity_id_;
     }
 
     /**
     * Returns the id of the property for which this description is used.
     */
-    int getID() {
+    int getID() const {
       return id_;
     }
 
@@ -125,28 +204,76 @@ namespace tcp_io_device {
     * Returns the full length of the data assigned to this MetaData object
     * Number of data parts (e.g. double values) * the data size of each part (e.g. 8)
     */
-    uint64_t getDataLength() { return data_length_; }
+    uint64_t getDataLength() const { return data_length_; }
+
+    /**
+    * Returns the number of bytes used to store all data parts (data length * type size)
+    */
+    uint64_t getDataSize() const { return data_size_; }
 
     /**
-    * Returns the number of bytes used to store a data object (e.g. 8 for double)
+    * Returns the number of bytes used to store a single data part (e.g. 8 for double, 4 for float)
     */
-    uint64_t getDataSize() { return data_size_; }
+    size_t getTypeSize() const { return type_size_; }
 
     /**
     * Returns the dimensions of the data. E.g. [1920, 1080] for a full HD image.
     */
-    std::vector<uint64_t> getDimensions() { return dimensions_; }
+    std::vector<uint64_t> getDimensions() const { return dimensions_; }
 
     /**
     * Returns the type of the corresponding message.
     */
-    VariableDescription_DataType getType() { return type_; }
+    VariableDescription_DataType getType() const { return type_; }
 
     /**
     * Returns the opcode handle of the corresponding message.
     */
-    std::string getOpCodeHandle() { return opcode_handle_; }
+    std::string getOpCodeHandle() const { return opcode_handle_; }
+
+    /**
+    * Returns the encoding used to put the data of the corresponding message on the wire.
+    */
+    VariableDescription_Encoding getEncoding() const { return encoding_; }
+
+    /**
+    * Sets the encoding used to put the data of the corresponding message on the wire. Defaults to RAW.
+    * \param encoding The encoding to use, e.g. PACKED to send numeric values in the packed repeated fields.
+    */
+    void setEncoding(VariableDescription_Encoding encoding) { encoding_ = encoding; }
+
+    /**
+    * Returns the size of one quantization step of the LINEAR_INT8 and LINEAR_INT16 encodings.
+    */
+    double getScale() const { return scale_; }
+
+    /**
+    * Returns the value represented by a quantized 0 of the LINEAR_INT8 and LINEAR_INT16 encodings.
+    */
+    double getOffset() const { return offset_; }
+
+    /**
+    * Sets the quantization parameters of the LINEAR_INT8 and LINEAR_INT16 encodings, value = offset + q * scale.
+    * If scale is 0 (default) the range is computed from the minimum and maximum of each sent frame.
+    * \param scale The size of one quantization step.
+    * \param offset The value represented by q = 0.
+    */
+    void setQuantization(double scale, double offset) {
+      scale_ = scale;
+      offset_ = offset;
+    }
 
+    /**
+    * Returns the density threshold below which RAW data is sent with a sparse encoding.
+    */
+    double getSparseThreshold() const { return sparse_threshold_; }
+
+    /**
+    * Lets the sender choose a sparse encoding (SPARSE_COORDINATE or SPARSE_BITMAP, whichever is smaller) for frames
+    * of RAW data whose fraction of nonzero values is at most threshold. Only used on the sending side, 0 disables it.
+    * \param threshold The density threshold, e.g. 0.1 to send frames with at most 10% nonzero values sparse.
+    */
+    void setSparseThreshold(double threshold) { sparse_threshold_ = threshold; }
 
     /**
     * Sets the fields of the MetaData object.
@@ -161,27 +288,12 @@ namespace tcp_io_device {
       type_ = t;
       dimensions_ = d;
       opcode_handle_ = opcode_handle;
-      switch (t)
-      {
-      case 0:
-        type_size_ = 8;
-        break;
-      case 3:
-        type_size_ = 8;
-        break;
-      case 15:
-        type_size_ = 8;
-        break;
-      default:
-        type_size_ = 1;
-        break;
-      }
-      data_size_ = 1;
+      type_size_ = typeSize(t);
       data_length_ = 1;
       for (int i = 0; i < dimensions_.size(); ++i) {
-        data_size_ *= dimensions_[i] * type_size_;
         data_length_ *= dimensions_[i];
       }
+      data_size_ = data_length_ * type_size_;
     }
 
     VariableDescription toVariableDescription() {
@@ -191,6 +303,9 @@ namespace tcp_io_device {
       var.set_datatype(type_);
       var.mutable_dimensions()->Add(dimensions_.begin(), dimensions_.end());
       var.set_opcode_string_handle(opcode_handle_);
+      var.set_encoding(encoding_);
+      var.set_scale(scale_);
+      var.set_offset(offset_);
       return var;
     }
     void toMutableVariableDescription(VariableDescription* mutable_variable_description) {
@@ -199,6 +314,9 @@ namespace tcp_io_device {
       mutable_variable_description->set_datatype(type_);
       mutable_variable_description->mutable_dimensions()->Add(dimensions_.begin(), dimensions_.end());
       mutable_variable_description->set_opcode_string_handle(opcode_handle_);
+      mutable_variable_description->set_encoding(encoding_);
+      mutable_variable_description->set_scale(scale_);
+      mutable_variable_description->set_offset(offset_);
     }
 
     friend std::ostream& operator<<(std::ostream& output, const MetaData& meta_data) {
@@ -210,6 +328,7 @@ namespace tcp_io_device {
         << "DataSize: " << meta_data.data_size_ << std::endl
         << "DataLength: " << meta_data.data_length_ << std::endl
         << "OpCodeHandle: " << meta_data.opcode_handle_ << std::endl
+        << "Encoding: " << meta_data.encoding_ << std::endl
         << "Dimensions: { ";
       for (auto it = meta_data.dimensions_.begin(); it != meta_data.dimensions_.end(); ++it) {
         output << *it << " ";
@@ -220,22 +339,723 @@ namespace tcp_io_device {
   };
 
   /**
-  * Class to store a DataMessage including a MetaData object and a string for the bytes of data.
+  * Maps sparse int32 IDs to dense indices 0..size()-1, in ascending order of the IDs. If the IDs span a compact range
+  * the index is a direct lookup table, otherwise a binary search over the sorted IDs. Immutable once built.
+  */
+  class DenseIndex {
+  public:
+    DenseIndex() {}
+
+    /**
+    * Builds the index of the passed IDs, duplicates are ignored.
+    * \param ids The IDs to index.
+    */
+    DenseIndex(std::vector<int> ids) {
+      std::sort(ids.begin(), ids.end());
+      ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+      sorted_ = ids;
+      if (sorted_.empty()) {
+        return;
+      }
+      // Use a direct table unless it would be much larger than the number of IDs.
+      int64_t range = (int64_t)sorted_.back() - sorted_.front() + 1;
+      if (range <= 4 * (int64_t)sorted_.size() + 64) {
+        min_ = sorted_.front();
+        direct_.assign((size_t)range, -1);
+        for (size_t i = 0; i < sorted_.size(); ++i) {
+          direct_[(size_t)(sorted_[i] - min_)] = (int)i;
+        }
+      }
+    }
+
+    /**
+    * Returns the dense index of the ID, -1 if the ID is not indexed.
+    */
+    int indexOf(int id) const {
+      if (!direct_.empty()) {
+        uint64_t offset = (uint64_t)((int64_t)id - min_);
+        return offset < direct_.size() ? direct_[offset] : -1;
+      }
+      auto it = std::lower_bound(sorted_.begin(), sorted_.end(), id);
+      return it != sorted_.end() && *it == id ? (int)(it - sorted_.begin()) : -1;
+    }
+
+    /**
+    * Returns the ID with the passed dense index.
+    */
+    int idAt(size_t index) const { return sorted_[index]; }
+
+    /**
+    * Returns the number of indexed IDs.
+    */
+    size_t size() const { return sorted_.size(); }
+
+  private:
+    std::vector<int> sorted_;
+    std::vector<int> direct_;
+    int64_t min_ = 0;
+  };
+
+  /**
+  * Immutable name <-> ID table, e.g. of the entities map of a SetupMessage. Names are found by a binary search over
+  * the sorted names, IDs through a DenseIndex.
+  */
+  class NameTable {
+  public:
+    NameTable() {}
+
+    /**
+    * Builds the table from a name -> ID map of the SetupMessage.
+    */
+    NameTable(const google::protobuf::Map<std::string, int32_t>& names) : NameTable(std::vector<std::pair<std::string, int>>(names.begin(), names.end())) {}
+
+    /**
+    * Builds the table from name -> ID pairs. If a name appears twice, the first pair is used.
+    */
+    NameTable(std::vector<std::pair<std::string, int>> names) {
+      std::stable_sort(names.begin(), names.end(), [](const std::pair<std::string, int>& a, const std::pair<std::string, int>& b) {
+        return a.first < b.first;
+        });
+      names.erase(std::unique(names.begin(), names.end(), [](const std::pair<std::string, int>& a, const std::pair<std::string, int>& b) {
+        return a.first == b.first;
+        }), names.end());
+      sorted_ = names;
+      std::vector<int> ids;
+      for (const std::pair<std::string, int>& name : sorted_) {
+        ids.push_back(name.second);
+      }
+      ids_ = DenseIndex(ids);
+      // The (alphabetically) first name of each ID.
+      names_by_index_.assign(ids_.size(), -1);
+      for (size_t i = 0; i < sorted_.size(); ++i) {
+        int& name = names_by_index_[ids_.indexOf(sorted_[i].second)];
+        if (name < 0) {
+          name = (int)i;
+        }
+      }
+    }
+
+    /**
+    * Looks up the ID of a name.
+    * \param name The name to look up.
+    * \param id Set to the ID of the name, unchanged if the name is unknown.
+    * \return true if the name is known.
+    */
+    bool find(const std::string& name, int& id) const {
+      auto it = std::lower_bound(sorted_.begin(), sorted_.end(), name, [](const std::pair<std::string, int>& a, const std::string& b) {
+        return a.first < b;
+        });
+      if (it == sorted_.end() || it->first != name) {
+        return false;
+      }
+      id = it->second;
+      return true;
+    }
+
+    /**
+    * Returns the name of an ID, NULL if the ID is unknown.
+    */
+    const std::string* findName(int id) const {
+      int index = ids_.indexOf(id);
+      return index >= 0 ? &sorted_[names_by_index_[index]].first : NULL;
+    }
+
+    /**
+    * Returns the DenseIndex of the IDs of the table.
+    */
+    const DenseIndex& getIDs() const { return ids_; }
+
+    /**
+    * Returns the number of names.
+    */
+    size_t size() const { return sorted_.size(); }
+
+  private:
+    std::vector<std::pair<std::string, int>> sorted_;
+    DenseIndex ids_;
+    // Index into sorted_ for every dense index of ids_.
+    std::vector<int> names_by_index_;
+  };
+
+  /**
+  * Flat lookup tables built once from a SetupMessage. Besides the name tables, every (entityID, ID) pair of the setup
+  * gets a dense slot: entity index * number of IDs + ID index, where the entities are those of the entities map and
+  * the command descriptions, and the IDs those of the objects and commands maps and the command descriptions. Slots
+  * can index flat per-variable arrays instead of hash maps keyed by MetaData.
+  */
+  class SetupTables {
+  public:
+    SetupTables() {}
+
+    /**
+    * Builds the tables of a SetupMessage.
+    * \param setup The SetupMessage.
+    */
+    SetupTables(const SetupMessage& setup) : entities_(setup.entities()), objects_(setup.objects()), commands_(setup.commands()) {
+      std::vector<int> entity_ids;
+      std::vector<int> ids;
+      for (const auto& entity : setup.entities()) {
+        entity_ids.push_back(entity.second);
+      }
+      for (const auto& object : setup.objects()) {
+        ids.push_back(object.second);
+      }
+      for (const auto& command : setup.commands()) {
+        ids.push_back(command.second);
+      }
+      for (const CommandDescription& command : setup.commanddescriptions()) {
+        entity_ids.push_back(command.description().entityid());
+        ids.push_back(command.description().id());
+      }
+      entity_ids_ = DenseIndex(entity_ids);
+      ids_ = DenseIndex(ids);
+    }
+
+    const NameTable& getEntities() const { return entities_; }
+    const NameTable& getObjects() const { return objects_; }
+    const NameTable& getCommands() const { return commands_; }
+
+    /**
+    * Returns the dense slot of a variable, -1 if its entity or ID is not part of the setup.
+    * \param entity_id The entity ID of the variable.
+    * \param id The ID of the variable.
+    */
+    int getSlot(int entity_id, int id) const {
+      int entity_index = entity_ids_.indexOf(entity_id);
+      int id_index = ids_.indexOf(id);
+      if (entity_index < 0 || id_index < 0) {
+        return -1;
+      }
+      return entity_index * (int)ids_.size() + id_index;
+    }
+
+    /**
+    * Returns the dense slot of a variable, -1 if its entity or ID is not part of the setup.
+    */
+    int getSlot(const MetaData& meta_data) const { return getSlot(meta_data.getEntityID(), meta_data.getID()); }
+
+    /**
+    * Returns the number of slots, all slots are in [0, getSlotCount()).
+    */
+    size_t getSlotCount() const { return entity_ids_.size() * ids_.size(); }
+
+    /**
+    * Returns the entity ID of a slot.
+    */
+    int getEntityID(int slot) const { return entity_ids_.idAt(slot / ids_.size()); }
+
+    /**
+    * Returns the ID of a slot.
+    */
+    int getID(int slot) const { return ids_.idAt(slot % ids_.size()); }
+
+  private:
+    NameTable entities_;
+    NameTable objects_;
+    NameTable commands_;
+    DenseIndex entity_ids_;
+    DenseIndex ids_;
+  };
+
+  /**
+  * Allocator interface for the payload storage of MsgData. Implement it to place payloads in e.g. a memory pool.
+  */
+  class PayloadAllocator {
+  public:
+    virtual ~PayloadAllocator() {}
+
+    /**
+    * Returns a block of at least size bytes, aligned to alignment bytes.
+    */
+    virtual void* allocate(size_t size, size_t alignment) = 0;
+
+    /**
+    * Releases a block returned by allocate with the same size and alignment.
+    */
+    virtual void deallocate(void* ptr, size_t size, size_t alignment) = 0;
+  };
+
+  /**
+  * Default PayloadAllocator using the aligned operator new.
+  */
+  class AlignedNewAllocator : public PayloadAllocator {
+  public:
+    void* allocate(size_t size, size_t alignment) override {
+      return ::operator new(size, std::align_val_t(alignment));
+    }
+
+    void deallocate(void* ptr, size_t /*size*/, size_t alignment) override {
+      ::operator delete(ptr, std::align_val_t(alignment));
+    }
+  };
+
+  /**
+  * Byte buffer whose storage is aligned to a cache line (64 bytes), so that vectorized consumers can use aligned loads
+  * directly on the payload of a MsgData. Storage is taken from a pluggable PayloadAllocator.
+  * A buffer can also borrow bytes owned by someone else (see borrow()), e.g. a payload in a received frame. Borrowed
+  * bytes are never written, they are copied into own storage on the first non-const access.
+  */
+  class AlignedBuffer {
+  public:
+    static constexpr size_t alignment = 64;
+
+    AlignedBuffer() : allocator_(defaultAllocator()) {}
+
+    AlignedBuffer(const AlignedBuffer& other) : allocator_(other.allocator_) {
+      *this = other;
+    }
+
+    AlignedBuffer(AlignedBuffer&& other) noexcept
+      : allocator_(other.allocator_), data_(other.data_), size_(other.size_), capacity_(other.capacity_),
+      borrowed_(other.borrowed_), owner_(std::move(other.owner_)) {
+      other.data_ = nullptr;
+      other.size_ = 0;
+      other.capacity_ = 0;
+      other.borrowed_ = nullptr;
+    }
+
+    AlignedBuffer& operator=(const AlignedBuffer& other) {
+      if (this != &other) {
+        if (other.borrowed_) {
+          // Copies share the borrowed bytes.
+          borrow(other.borrowed_, other.size_, other.owner_);
+        }
+        else {
+          assign(other.data_, other.size_);
+        }
+      }
+      return *this;
+    }
+
+    AlignedBuffer& operator=(AlignedBuffer&& other) noexcept {
+      if (this != &other) {
+        release();
+        allocator_ = other.allocator_;
+        data_ = other.data_;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        borrowed_ = other.borrowed_;
+        owner_ = std::move(other.owner_);
+        other.data_ = nullptr;
+        other.size_ = 0;
+        other.capacity_ = 0;
+        other.borrowed_ = nullptr;
+      }
+      return *this;
+    }
+
+    ~AlignedBuffer() { release(); }
+
+    /**
+    * Returns the allocator used for new buffers. Replace it with setDefaultAllocator before any MsgData is created.
+    */
+    static std::shared_ptr<PayloadAllocator>& defaultAllocator() {
+      static std::shared_ptr<PayloadAllocator> allocator = std::make_shared<AlignedNewAllocator>();
+      return allocator;
+    }
+
+    static void setDefaultAllocator(std::shared_ptr<PayloadAllocator> allocator) {
+      defaultAllocator() = allocator;
+    }
+
+    char* data() { own(); return data_ ? data_ : emptyData(); }
+    const char* data() const { return borrowed_ ? borrowed_ : data_ ? data_ : emptyData(); }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    char& operator[](size_t i) { own(); return data_[i]; }
+    const char& operator[](size_t i) const { return data()[i]; }
+
+    /**
+    * Points the buffer to size bytes owned by someone else, without copying them. Only the alignment of data applies.
+    * \param data The borrowed bytes, not written through this buffer.
+    * \param size The number of bytes.
+    * \param owner Kept by the buffer (and its copies) as long as the bytes are borrowed.
+    */
+    void borrow(const char* data, size_t size, std::shared_ptr<const void> owner) {
+      release();
+      borrowed_ = data;
+      size_ = size;
+      owner_ = std::move(owner);
+    }
+
+    /**
+    * Returns true if the bytes are borrowed, i.e. not copied into own storage yet.
+    */
+    bool isBorrowed() const { return borrowed_ != nullptr; }
+
+    /**
+    * Resizes the buffer, keeping its contents. New bytes are zero.
+    */
+    void resize(size_t size) {
+      reserve(size);
+      if (size > size_) {
+        memset(data_ + size_, 0, size - size_);
+      }
+      size_ = size;
+    }
+
+    /**
+    * Makes sure the buffer can hold size bytes without reallocation.
+    */
+    void reserve(size_t size) {
+      own();
+      if (size <= capacity_) {
+        return;
+      }
+      // Round up to full cache lines.
+      size_t capacity = (size + alignment - 1) / alignment * alignment;
+      char* data = (char*)allocator_->allocate(capacity, alignment);
+      if (size_ > 0) {
+        memcpy(data, data_, size_);
+      }
+      size_t old_size = size_;
+      release();
+      data_ = data;
+      size_ = old_size;
+      capacity_ = capacity;
+    }
+
+    /**
+    * Replaces the contents of the buffer with size bytes copied from data. data may point into the buffer itself.
+    */
+    void assign(const char* data, size_t size) {
+      // Keeps borrowed bytes alive, data may point into them.
+      std::shared_ptr<const void> owner = std::move(owner_);
+      borrowed_ = nullptr;
+      size_ = 0;
+      // Bytes of the own storage fit its capacity, so reserve does not free them. They may overlap the destination.
+      reserve(size);
+      if (size > 0) {
+        memmove(data_, data, size);
+      }
+      size_ = size;
+    }
+
+  private:
+    static char* emptyData() {
+      // Returned for empty buffers, so data() is never a null pointer.
+      alignas(alignment) static char empty[alignment] = {};
+      return empty;
+    }
+
+    void release() {
+      if (data_) {
+        allocator_->deallocate(data_, capacity_, alignment);
+      }
+      data_ = nullptr;
+      size_ = 0;
+      capacity_ = 0;
+      borrowed_ = nullptr;
+      owner_.reset();
+    }
+
+    /**
+    * Copies borrowed bytes into own storage. Does nothing if the bytes are owned already.
+    */
+    void own() {
+      if (borrowed_) {
+        assign(borrowed_, size_);
+      }
+    }
+
+    std::shared_ptr<PayloadAllocator> allocator_;
+    char* data_ = nullptr;
+    size_t size_ = 0;
+    size_t capacity_ = 0;
+    const char* borrowed_ = nullptr;
+    std::shared_ptr<const void> owner_;
+  };
+
+  /**
+  * Read-only, strided view on the values of a multi-dimensional variable, similar to std::mdspan. Element (i0, i1, ...)
+  * is located at sum(ik * strides[k]) values from the start. A view created from a MsgData is row-major, i.e. the last
+  * of the MetaData dimensions is contiguous. Slicing and region extraction return new views on the same bytes, nothing
+  * is copied until copy() is called. The view does not own the bytes, the viewed MsgData must outlive it.
+  */
+  template <typename T>
+  class TensorView {
+  private:
+    const char* data_;
+    std::vector<uint64_t> shape_;
+    std::vector<uint64_t> strides_;
+
+  public:
+    /**
+    * Constructor for TensorView objects.
+    * \param data Pointer to the first element.
+    * \param shape The number of elements in every dimension.
+    * \param strides The distance between two consecutive elements of every dimension, counted in elements.
+    */
+    TensorView(const char* data, std::vector<uint64_t> shape, std::vector<uint64_t> strides)
+      : data_(data), shape_(shape), strides_(strides) {}
+
+    /**
+    * Creates a row-major view with the passed shape on contiguous data.
+    */
+    static TensorView rowMajor(const char* data, std::vector<uint64_t> shape) {
+      std::vector<uint64_t> strides(shape.size(), 1);
+      for (int i = (int)shape.size() - 2; i >= 0; --i) {
+        strides[i] = strides[i + 1] * shape[i + 1];
+      }
+      return TensorView(data, shape, strides);
+    }
+
+    size_t rank() const { return shape_.size(); }
+
+    const std::vector<uint64_t>& shape() const { return shape_; }
+
+    const std::vector<uint64_t>& strides() const { return strides_; }
+
+    /**
+    * Returns the number of elements in the view.
+    */
+    uint64_t size() const {
+      uint64_t size = 1;
+      for (uint64_t s : shape_) {
+        size *= s;
+      }
+      return size;
+    }
+
+    /**
+    * Returns true if the elements of the view are stored row-major without gaps.
+    */
+    bool isContiguous() const {
+      uint64_t expected = 1;
+      for (int i = (int)shape_.size() - 1; i >= 0; --i) {
+        if (shape_[i] != 1 && strides_[i] != expected) {
+          return false;
+        }
+        expected *= shape_[i];
+      }
+      return true;
+    }
+
+    /**
+    * Returns the element at the passed indices, one per dimension. Indices are not range checked.
+    */
+    template <typename... Indices>
+    T operator()(Indices... indices) const {
+      static_assert(sizeof...(Indices) > 0, "At least one index is needed");
+      const uint64_t idx[] = { (uint64_t)indices... };
+      uint64_t offset = 0;
+      for (size_t i = 0; i < sizeof...(Indices); ++i) {
+        offset += idx[i] * strides_[i];
+      }
+      return load(offset);
+    }
+
+    /**
+    * Returns the element at the passed indices, one per dimension. Indices are not range checked.
+    */
+    T at(const std::vector<uint64_t>& indices) const {
+      uint64_t offset = 0;
+      for (size_t i = 0; i < indices.size(); ++i) {
+        offset += indices[i] * strides_[i];
+      }
+      return load(offset);
+    }
+
+    /**
+    * Restricts dimension dim to the elements begin, begin + step, ... < end without copying. end is clamped to the shape.
+    */
+    TensorView slice(size_t dim, uint64_t begin, uint64_t end, uint64_t step = 1) const {
+      TensorView view = *this;
+      end = std::min(end, shape_[dim]);
+      begin = std::min(begin, end);
+      view.data_ += begin * strides_[dim] * sizeof(T);
+      view.shape_[dim] = (end - begin + step - 1) / step;
+      view.strides_[dim] *= step;
+      return view;
+    }
+
+    /**
+    * Fixes dimension dim to index, returning a view with one dimension less (e.g. a row of an image) without copying.
+    */
+    TensorView select(size_t dim, uint64_t index) const {
+      TensorView view = *this;
+      view.data_ += index * strides_[dim] * sizeof(T);
+      view.shape_.erase(view.shape_.begin() + dim);
+      view.strides_.erase(view.strides_.begin() + dim);
+      return view;
+    }
+
+    /**
+    * Returns the region of interest starting at begin with the passed extent in every dimension without copying.
+    */
+    TensorView region(const std::vector<uint64_t>& begin, const std::vector<uint64_t>& extent) const {
+      TensorView view = *this;
+      for (size_t i = 0; i < begin.size() && i < shape_.size(); ++i) {
+        view = view.slice(i, begin[i], begin[i] + extent[i]);
+      }
+      return view;
+    }
+
+    /**
+    * Copies the elements of the view row-major into dst, which must have room for size() elements. Contiguous runs of
+    * the last dimension are copied with a single memcpy.
+    */
+    void copyTo(T* dst) const {
+      if (shape_.empty()) {
+        memcpy(dst, data_, sizeof(T));
+        return;
+      }
+      uint64_t total = size();
+      if (total == 0) {
+        return;
+      }
+      size_t last = shape_.size() - 1;
+      uint64_t run = shape_[last];
+      std::vector<uint64_t> idx(shape_.size(), 0);
+      for (uint64_t done = 0; done < total; done += run) {
+        uint64_t offset = 0;
+        for (size_t i = 0; i < last; ++i) {
+          offset += idx[i] * strides_[i];
+        }
+        if (strides_[last] == 1) {
+          memcpy(dst + done, data_ + offset * sizeof(T), run * sizeof(T));
+        }
+        else {
+          for (uint64_t j = 0; j < run; ++j) {
+            dst[done + j] = load(offset + j * strides_[last]);
+          }
+        }
+        // Advance the outer indices like an odometer.
+        for (int i = (int)last - 1; i >= 0; --i) {
+          if (++idx[i] < shape_[i]) {
+            break;
+          }
+          idx[i] = 0;
+        }
+      }
+    }
+
+    /**
+    * Materializes the elements of the view row-major into a new vector.
+    */
+    std::vector<T> copy() const {
+      std::vector<T> values(size());
+      copyTo(values.data());
+      return values;
+    }
+
+  private:
+    T load(uint64_t offset) const {
+      T value;
+      memcpy(&value, data_ + offset * sizeof(T), sizeof(T));
+      return value;
+    }
+  };
+
+  /**
+  * Class to store a DataMessage including a MetaData object and a cache-line aligned buffer for the bytes of data.
   */
   class MsgData {
+    template <typename T> friend class TypedMsgData;
+    friend class WireEncoder;
+    friend class SubscriptionFilter;
+
   private:
     MetaData meta_data_;
-    std::string data_;
+    AlignedBuffer data_;
     bool valid_ = true;
+
+    /**
+    * Data received with a sparse encoding: the flat indices and values of the nonzero entries. The dense bytes are only
+    * created on the first access to them, std::call_once keeps that safe for threads reading the same MsgData. Copies
+    * of the MsgData share this object, so it is densified at most once.
+    */
+    struct SparseData {
+      std::vector<uint64_t> indices;
+      AlignedBuffer values;
+      size_t width = 0;
+      size_t count = 0;
+      std::once_flag densified;
+      AlignedBuffer dense;
+
+      const char* denseBytes() {
+        std::call_once(densified, [this]() {
+          dense.resize(count * width);
+          for (size_t i = 0; i < indices.size(); ++i) {
+            if (indices[i] < count) {
+              memcpy(dense.data() + indices[i] * width, values.data() + i * width, width);
+            }
+          }
+          });
+        return static_cast<const AlignedBuffer&>(dense).data();
+      }
+    };
+    // Set while the data is the received sparse data, data_ is empty then.
+    std::shared_ptr<SparseData> sparse_;
     MsgData() {}
   public:
 
     /**
-    * Constructor for MsgData objects. Converts a ProtoVariable message to a MsgData object.
+    * Constructor for MsgData objects. Converts a ProtoVariable message to a MsgData object. Values sent in one of the
+    * packed repeated fields or in a reduced precision encoding are decoded, so the MsgData looks the same as if they
+    * were sent as raw bytes in the data field.
     * \param msg The message used to convert and create a MsgData object from.
+    * \param byte_order The byte order of the sender as announced in its SetupMessage or StartMessage. Values in the data
+    * field are converted to the host byte order if it differs.
     */
-    MsgData(const ProtoVariable* msg) : meta_data_(&(msg->metadata())) {
-      setData(msg->data());
+    MsgData(const ProtoVariable* msg, TCPMessage_ByteOrder byte_order = hostByteOrder()) : meta_data_(&(msg->metadata())) {
+      if (isReducedEncoding(meta_data_.encoding_) && isFloatingPoint(meta_data_.type_)) {
+        fromReducedEncoding(msg->data(), byte_order);
+      }
+      else if (meta_data_.encoding_ == VariableDescription_Encoding_BIT_PACKED && meta_data_.type_ == VariableDescription_DataType_BOOL) {
+        fromBitPacked(msg->data());
+      }
+      else if (isSparseEncoding(meta_data_.encoding_)) {
+        fromSparseEncoding(msg, byte_order);
+      }
+      else if (msg->doubledata_size() > 0) {
+        setData(msg->doubledata().data(), msg->doubledata_size());
+      }
+      else if (msg->floatdata_size() > 0) {
+        setData(msg->floatdata().data(), msg->floatdata_size());
+      }
+      else if (msg->int64data_size() > 0) {
+        setData(msg->int64data().data(), msg->int64data_size());
+      }
+      else if (msg->int32data_size() > 0) {
+        setData(msg->int32data().data(), msg->int32data_size());
+      }
+      else if (msg->uint64data_size() > 0) {
+        setData(msg->uint64data().data(), msg->uint64data_size());
+      }
+      else if (msg->uint32data_size() > 0) {
+        setData(msg->uint32data().data(), msg->uint32data_size());
+      }
+      else if (msg->booldata_size() > 0) {
+        setData(msg->booldata().data(), msg->booldata_size());
+      }
+      else {
+        setData(msg->data(), byte_order);
+      }
+    }
+
+    /**
+    * Constructor for a variable parsed by LazyMessage, whose RAW payload was left in the received frame. The payload is
+    * borrowed instead of copied if it is in the host byte order and aligned for the data type, otherwise it is copied
+    * once. Changing the data of the MsgData copies borrowed bytes first, the frame is never written.
+    * \param msg The ProtoVariable with the meta data, its data field is ignored if payload is set.
+    * \param payload The RAW payload of the variable in the frame, a null view if the data is in msg.
+    * \param owner Keeps the frame alive as long as this MsgData (or a copy) borrows from it.
+    * \param byte_order The byte order of the sender as announced in its SetupMessage or StartMessage.
+    */
+    MsgData(const ProtoVariable* msg, std::string_view payload, std::shared_ptr<const void> owner,
+      TCPMessage_ByteOrder byte_order = hostByteOrder()) : MsgData(msg, byte_order) {
+      if (payload.data() == nullptr || meta_data_.encoding_ != VariableDescription_Encoding_RAW || !data_.empty()) {
+        return;
+      }
+      size_t alignment = visit(meta_data_.type_, [](auto traits) { return decltype(traits)::alignment; });
+      bool swap = byte_order != hostByteOrder() && meta_data_.type_size_ > 1;
+      if (!swap && (uintptr_t)payload.data() % alignment == 0) {
+        data_.borrow(payload.data(), payload.size(), std::move(owner));
+      }
+      else {
+        setData(payload.data(), payload.size(), byte_order);
+      }
     }
 
     template<typename T>
@@ -270,23 +1090,62 @@ namespace tcp_io_device {
     }
 
     /**
-    * Setter for the data of the message. Data is stored as a byte representation in form of a std::string.
+    * Setter for the data of the message. Data is stored as a byte representation in a 64-byte aligned buffer.
     * \param d The byte representation of the data in form of a std::string.
     */
     void setData(const std::string& d) {
-      data_ = d;
+      clearSparse();
+      data_.assign(d.data(), d.size());
+    }
+
+    /**
+    * Setter for the data of the message from bytes in the passed byte order. The values are converted to the host byte
+    * order, using the type size of the MetaData.
+    * \param d The byte representation of the data in form of a std::string.
+    * \param byte_order The byte order of the values in d.
+    */
+    void setData(const std::string& d, TCPMessage_ByteOrder byte_order) {
+      setData(d.data(), d.size(), byte_order);
+    }
+
+    /**
+    * Setter for the data of the message from size bytes in the passed byte order, see setData(d, byte_order).
+    */
+    void setData(const char* d, size_t size, TCPMessage_ByteOrder byte_order) {
+      clearSparse();
+      data_.assign(d, size);
+      if (byte_order != hostByteOrder() && !data_.empty()) {
+        kernels::byteSwap(&data_[0], data_.size() / meta_data_.type_size_, meta_data_.type_size_);
+      }
     }
 
     template<typename T>
     void setData(const std::vector<T>& data) {
-      std::string data_string;
-      for (auto it = data.begin(); it != data.end(); ++it) {
-        char data_char[sizeof(T)];
-        T value = *it;
-        memcpy(data_char, &value, sizeof(T));
-        data_string.append(std::string(data_char, sizeof(T)));
+      if constexpr (std::is_same<T, bool>::value) {
+        // std::vector<bool> is not contiguous, copy the values one by one.
+        clearSparse();
+        data_.resize(data.size());
+        for (size_t i = 0; i < data.size(); ++i) {
+          data_[i] = data[i];
+        }
+      }
+      else {
+        setData(data.data(), data.size());
+      }
+    }
+
+    /**
+    * Setter for the data of the message from a contiguous array of values, copied in a single memcpy.
+    * \param values Pointer to the first value.
+    * \param count The number of values.
+    */
+    template<typename T>
+    void setData(const T* values, size_t count) {
+      clearSparse();
+      data_.resize(count * sizeof(T));
+      if (count > 0) {
+        memcpy(&data_[0], values, count * sizeof(T));
       }
-      setData(data_string);
     }
 
     /**
@@ -296,37 +1155,513 @@ namespace tcp_io_device {
       return meta_data_;
     }
 
-    std::string _data() { return data_; }
+    std::string _data() {
+      return std::string(bytes(), getDataSize());
+    }
+
+    /**
+    * Returns the number of bytes of the data.
+    */
+    size_t getDataSize() const {
+      return sparse_ ? sparse_->count * sparse_->width : data_.size();
+    }
+
+    /**
+    * Returns a pointer to the data, aligned to AlignedBuffer::alignment (64 bytes), so it can be read with aligned vector
+    * loads. Data borrowed from a received frame (see LazyMessage) is only aligned for T. Only valid as long as this
+    * MsgData is alive and its data is not changed.
+    */
+    template <typename T>
+    const T* getDataPointer() const {
+      return (const T*)bytes();
+    }
 
     /**
     * Casts the data from the byte representation stored as a string to the template type. @todo: Check for dimensionality.
     */
-    template <typename T> std::vector<T> getData() {
-      T a;
-      std::vector<T> values;
-      for (int i = 0; i < data_.size(); i += sizeof(T)) {
-        char* pos = &data_[i];
-        memcpy(&a, pos, sizeof(T));
-        values.push_back(a);
+    template <typename T> std::vector<T> getData() const {
+      std::vector<T> values(getDataSize() / sizeof(T));
+      if constexpr (std::is_same<T, bool>::value) {
+        for (size_t i = 0; i < values.size(); ++i) {
+          values[i] = bytes()[i] != 0;
+        }
+      }
+      else if (!values.empty()) {
+        memcpy(values.data(), bytes(), values.size() * sizeof(T));
       }
       return values;
     }
 
+    /**
+    * Returns the values converted to D in a single pass over the stored bytes, e.g. getDataAs<float>() on DOUBLE or
+    * INT64 data. Uses the vectorized conversion kernels where available.
+    */
+    template <typename D> std::vector<D> getDataAs() const {
+      static_assert(!std::is_same<D, bool>::value, "Use getData<bool>() for BOOL data");
+      return visit(meta_data_.type_, [this](auto traits) {
+        using S = typename decltype(traits)::type;
+        std::vector<D> values(getDataSize() / sizeof(S));
+        if constexpr (std::is_same<S, D>::value) {
+          if (!values.empty()) {
+            memcpy(values.data(), bytes(), values.size() * sizeof(D));
+          }
+        }
+        else {
+          kernels::convert(getDataPointer<S>(), values.data(), values.size());
+        }
+        return values;
+        });
+    }
+
+    /**
+    * Writes the MsgData into the passed ProtoVariable. If the encoding of the MetaData is PACKED, numeric values are put
+    * in the packed repeated field matching the data type instead of the data field. The reduced precision encodings
+    * (FLOAT16, BFLOAT16, LINEAR_INT8, LINEAR_INT16) are applied to DOUBLE and FLOAT data and BIT_PACKED to BOOL data,
+    * other types are sent RAW. The sparse encodings are used if set explicitly or if the density of nonzero values is
+    * at most the sparse threshold of the MetaData.
+    * \param var The ProtoVariable to fill.
+    */
     void toMutableProtoVariable(ProtoVariable* var) {
       VariableDescription* meta_data = var->mutable_metadata();
       meta_data_.toMutableVariableDescription(meta_data);
-      var->set_data(data_);
+      if (toSparseEncoding(var)) {
+        return;
+      }
+      if (isReducedEncoding(meta_data_.encoding_)) {
+        if (isFloatingPoint(meta_data_.type_)) {
+          toReducedEncoding(var);
+          return;
+        }
+        meta_data->set_encoding(VariableDescription_Encoding_RAW);
+      }
+      if (meta_data_.encoding_ == VariableDescription_Encoding_BIT_PACKED) {
+        if (meta_data_.type_ == VariableDescription_DataType_BOOL) {
+          std::string packed((getDataSize() + 7) / 8, '\0');
+          kernels::packBits((const uint8_t*)bytes(), (uint8_t*)&packed[0], getDataSize());
+          var->set_data(packed);
+          return;
+        }
+        meta_data->set_encoding(VariableDescription_Encoding_RAW);
+      }
+      if (meta_data_.encoding_ != VariableDescription_Encoding_PACKED) {
+        var->set_data(bytes(), getDataSize());
+        return;
+      }
+      switch (meta_data_.type_) {
+      case VariableDescription_DataType_DOUBLE:
+        toPackedField(var->mutable_doubledata());
+        break;
+      case VariableDescription_DataType_FLOAT:
+        toPackedField(var->mutable_floatdata());
+        break;
+      case VariableDescription_DataType_INT64:
+      case VariableDescription_DataType_COMMUNICATION_ID:
+        toPackedField(var->mutable_int64data());
+        break;
+      case VariableDescription_DataType_INT32:
+        toPackedField(var->mutable_int32data());
+        break;
+      case VariableDescription_DataType_UINT64:
+        toPackedField(var->mutable_uint64data());
+        break;
+      case VariableDescription_DataType_UINT32:
+        toPackedField(var->mutable_uint32data());
+        break;
+      case VariableDescription_DataType_BOOL:
+        toPackedField(var->mutable_booldata());
+        break;
+      default:
+        var->set_data(bytes(), getDataSize());
+        break;
+      }
     }
 
     friend std::ostream& operator<<(std::ostream& output, const MsgData& msg_data) {
       output << "MsgData Object: " << std::endl
         << msg_data.meta_data_ << std::endl
         << "Data: " << std::endl;
-      for (int i = 0; i < msg_data.data_.size(); ++i) {
-        output << std::setw(2) << std::setfill('0') << std::hex << (int)(msg_data.data_[i] & 0xFF) << std::dec;
+      for (int i = 0; i < msg_data.getDataSize(); ++i) {
+        output << std::setw(2) << std::setfill('0') << std::hex << (int)(msg_data.bytes()[i] & 0xFF) << std::dec;
       }
       return output;
     }
     bool isValid() { return valid_; }
+
+    /**
+    * Returns a row-major TensorView on the data, shaped by the dimensions of the MetaData. Nothing is copied, the view
+    * is only valid as long as this MsgData is alive and its data is not changed.
+    */
+    template <typename T>
+    TensorView<T> getTensorView() const {
+      return TensorView<T>::rowMajor(bytes(), meta_data_.dimensions_);
+    }
+
+    /**
+    * Returns true if the data was received with a sparse encoding and not changed since. In this case getSparseIndices
+    * and getSparseValues give access to the nonzero values without scanning the dense data.
+    */
+    bool isSparse() const { return sparse_ != nullptr; }
+
+    /**
+    * Returns the flat (row-major) indices of the nonzero values of sparse data, empty if isSparse() is false.
+    */
+    const std::vector<uint64_t>& getSparseIndices() const {
+      static const std::vector<uint64_t> empty;
+      return sparse_ ? sparse_->indices : empty;
+    }
+
+    /**
+    * Returns the number of nonzero values of sparse data, 0 if isSparse() is false.
+    */
+    size_t getSparseSize() const { return sparse_ ? sparse_->indices.size() : 0; }
+
+    /**
+    * Returns a pointer to the nonzero values of sparse data, in the order of getSparseIndices, without densifying. Only
+    * valid as long as this MsgData is alive and its data is not changed, nullptr if isSparse() is false.
+    */
+    template <typename T> const T* getSparseValuesPointer() const {
+      return sparse_ ? (const T*)static_cast<const AlignedBuffer&>(sparse_->values).data() : nullptr;
+    }
+
+    /**
+    * Returns a copy of the nonzero values of sparse data, in the order of getSparseIndices.
+    */
+    template <typename T> std::vector<T> getSparseValues() const {
+      std::vector<T> values(getSparseSize());
+      if (!values.empty()) {
+        memcpy(values.data(), getSparseValuesPointer<T>(), values.size() * sizeof(T));
+      }
+      return values;
+    }
+
+    /**
+    * Returns true if the data is borrowed from a received frame, see LazyMessage.
+    */
+    bool isBorrowed() const { return data_.isBorrowed(); }
+
+  private:
+    /**
+    * Read access to the data, borrowed bytes are not copied.
+    */
+    const char* bytes() const { return sparse_ ? sparse_->denseBytes() : static_cast<const AlignedBuffer&>(data_).data(); }
+
+    static bool isSparseEncoding(VariableDescription_Encoding encoding) {
+      return encoding == VariableDescription_Encoding_SPARSE_COORDINATE || encoding == VariableDescription_Encoding_SPARSE_BITMAP;
+    }
+
+    /**
+    * Writes the data with a sparse encoding if it was requested explicitly or if the density is below the sparse threshold.
+    * \return True if the data was written, false if it should be written with the other encodings.
+    */
+    bool toSparseEncoding(ProtoVariable* var) {
+      bool explicit_sparse = isSparseEncoding(meta_data_.encoding_);
+      bool threshold = meta_data_.encoding_ == VariableDescription_Encoding_RAW && meta_data_.sparse_threshold_ > 0;
+      if ((!explicit_sparse && !threshold) || meta_data_.type_ == VariableDescription_DataType_STRING) {
+        if (explicit_sparse) {
+          var->mutable_metadata()->set_encoding(VariableDescription_Encoding_RAW);
+        }
+        return false;
+      }
+      size_t width = meta_data_.type_size_;
+      size_t count = getDataSize() / width;
+      std::vector<uint64_t> indices;
+      kernels::collectNonZero(bytes(), count, width, indices);
+      if (!explicit_sparse && (count == 0 || (double)indices.size() / count > meta_data_.sparse_threshold_)) {
+        return false;
+      }
+      VariableDescription_Encoding encoding = meta_data_.encoding_;
+      if (!explicit_sparse) {
+        // Coordinates cost about two bytes per nonzero value, the bitmap one bit per value.
+        encoding = indices.size() * 16 < count ? VariableDescription_Encoding_SPARSE_COORDINATE : VariableDescription_Encoding_SPARSE_BITMAP;
+      }
+      var->mutable_metadata()->set_encoding(encoding);
+      std::string values(indices.size() * width, '\0');
+      for (size_t i = 0; i < indices.size(); ++i) {
+        memcpy(&values[i * width], bytes() + indices[i] * width, width);
+      }
+      var->set_data(values);
+      if (encoding == VariableDescription_Encoding_SPARSE_COORDINATE) {
+        google::protobuf::RepeatedField<uint64_t>* sparse_indices = var->mutable_sparseindices();
+        sparse_indices->Reserve((int)indices.size());
+        uint64_t previous = 0;
+        for (uint64_t index : indices) {
+          sparse_indices->AddAlreadyReserved(index - previous);
+          previous = index;
+        }
+      }
+      else {
+        std::vector<uint8_t> flags(count, 0);
+        for (uint64_t index : indices) {
+          flags[index] = 1;
+        }
+        std::string bitmap((count + 7) / 8, '\0');
+        kernels::packBits(flags.data(), (uint8_t*)&bitmap[0], count);
+        var->set_sparsebitmap(bitmap);
+      }
+      return true;
+    }
+
+    /**
+    * Keeps the nonzero values and their indices of sparse data. The dense data is only created when it is accessed,
+    * see SparseData.
+    */
+    void fromSparseEncoding(const ProtoVariable* msg, TCPMessage_ByteOrder byte_order) {
+      std::shared_ptr<SparseData> sparse = std::make_shared<SparseData>();
+      sparse->width = meta_data_.type_size_;
+      sparse->count = meta_data_.data_length_;
+      sparse->values.assign(msg->data().data(), msg->data().size());
+      if (byte_order != hostByteOrder() && !sparse->values.empty()) {
+        kernels::byteSwap(sparse->values.data(), sparse->values.size() / sparse->width, sparse->width);
+      }
+      if (meta_data_.encoding_ == VariableDescription_Encoding_SPARSE_COORDINATE) {
+        sparse->indices.reserve(msg->sparseindices_size());
+        uint64_t index = 0;
+        for (uint64_t delta : msg->sparseindices()) {
+          index += delta;
+          sparse->indices.push_back(index);
+        }
+      }
+      else {
+        const std::string& bitmap = msg->sparsebitmap();
+        uint64_t bits = std::min<uint64_t>(sparse->count, bitmap.size() * 8);
+        for (uint64_t i = 0; i < bits; ++i) {
+          if ((bitmap[i / 8] >> (i % 8)) & 1) {
+            sparse->indices.push_back(i);
+          }
+        }
+      }
+      // Drop indices without a value.
+      sparse->indices.resize(std::min<size_t>(sparse->indices.size(), sparse->values.size() / sparse->width));
+      data_.resize(0);
+      sparse_ = std::move(sparse);
+    }
+
+    /**
+    * Drops the sparse data, called whenever the data is changed.
+    */
+    void clearSparse() {
+      sparse_.reset();
+    }
+
+    static bool isReducedEncoding(VariableDescription_Encoding encoding) {
+      return encoding == VariableDescription_Encoding_FLOAT16 || encoding == VariableDescription_Encoding_BFLOAT16 ||
+        encoding == VariableDescription_Encoding_LINEAR_INT8 || encoding == VariableDescription_Encoding_LINEAR_INT16;
+    }
+
+    static bool isFloatingPoint(VariableDescription_DataType type) {
+      return type == VariableDescription_DataType_DOUBLE || type == VariableDescription_DataType_FLOAT;
+    }
+
+    /**
+    * Encodes the DOUBLE or FLOAT values with the reduced precision encoding of the MetaData into the data field of var.
+    */
+    void toReducedEncoding(ProtoVariable* var) {
+      std::string encoded;
+      switch (meta_data_.encoding_) {
+      case VariableDescription_Encoding_FLOAT16:
+      case VariableDescription_Encoding_BFLOAT16: {
+        std::vector<float> values = getDataAs<float>();
+        std::vector<uint16_t> half(values.size());
+        if (meta_data_.encoding_ == VariableDescription_Encoding_FLOAT16) {
+          kernels::floatToHalf(values.data(), half.data(), values.size());
+        }
+        else {
+          kernels::floatToBFloat16(values.data(), half.data(), values.size());
+        }
+        encoded.assign((const char*)half.data(), half.size() * sizeof(uint16_t));
+        break;
+      }
+      default: {
+        // Quantized straight from the stored values, DOUBLE data is not narrowed to float first.
+        if (meta_data_.type_ == VariableDescription_DataType_DOUBLE) {
+          quantize(getDataPointer<double>(), getDataSize() / sizeof(double), var, encoded);
+        }
+        else {
+          quantize(getDataPointer<float>(), getDataSize() / sizeof(float), var, encoded);
+        }
+        break;
+      }
+      }
+      var->set_data(encoded);
+    }
+
+    /**
+    * Applies the LINEAR_INT8 or LINEAR_INT16 encoding of the MetaData to count values. If the MetaData has no scale, the
+    * range of the values is mapped to the full range of the quantized type and stored in the metadata of var.
+    */
+    template <typename S>
+    void quantize(const S* values, size_t count, ProtoVariable* var, std::string& encoded) {
+      bool int8 = meta_data_.encoding_ == VariableDescription_Encoding_LINEAR_INT8;
+      double q_min = int8 ? INT8_MIN : INT16_MIN;
+      double q_max = int8 ? INT8_MAX : INT16_MAX;
+      double scale = meta_data_.scale_;
+      double offset = meta_data_.offset_;
+      if (scale == 0 && count > 0) {
+        // Map the range of this frame to the full range of the quantized type.
+        auto range = std::minmax_element(values, values + count);
+        scale = (*range.second > *range.first) ? ((double)*range.second - (double)*range.first) / (q_max - q_min) : 1.0;
+        offset = (double)*range.first - q_min * scale;
+        var->mutable_metadata()->set_scale(scale);
+        var->mutable_metadata()->set_offset(offset);
+      }
+      if (int8) {
+        std::vector<int8_t> q(count);
+        kernels::quantize(values, q.data(), count, scale, offset);
+        encoded.assign((const char*)q.data(), q.size());
+      }
+      else {
+        std::vector<int16_t> q(count);
+        kernels::quantize(values, q.data(), count, scale, offset);
+        encoded.assign((const char*)q.data(), q.size() * sizeof(int16_t));
+      }
+    }
+
+    /**
+    * Decodes data sent with the reduced precision encoding of the MetaData back to DOUBLE or FLOAT values.
+    */
+    void fromReducedEncoding(const std::string& encoded, TCPMessage_ByteOrder byte_order) {
+      switch (meta_data_.encoding_) {
+      case VariableDescription_Encoding_FLOAT16:
+      case VariableDescription_Encoding_BFLOAT16: {
+        std::vector<uint16_t> half(encoded.size() / sizeof(uint16_t));
+        memcpy(half.data(), encoded.data(), half.size() * sizeof(uint16_t));
+        if (byte_order != hostByteOrder()) {
+          kernels::byteSwap(half.data(), half.size(), sizeof(uint16_t));
+        }
+        std::vector<float> values(half.size());
+        if (meta_data_.encoding_ == VariableDescription_Encoding_FLOAT16) {
+          kernels::halfToFloat(half.data(), values.data(), half.size());
+        }
+        else {
+          kernels::bfloat16ToFloat(half.data(), values.data(), half.size());
+        }
+        if (meta_data_.type_ == VariableDescription_DataType_FLOAT) {
+          setData(values.data(), values.size());
+        }
+        else {
+          std::vector<double> d(values.size());
+          kernels::convert(values.data(), d.data(), values.size());
+          setData(d.data(), d.size());
+        }
+        break;
+      }
+      case VariableDescription_Encoding_LINEAR_INT8:
+        dequantize((const int8_t*)encoded.data(), encoded.size());
+        break;
+      default: {
+        std::vector<int16_t> q(encoded.size() / sizeof(int16_t));
+        memcpy(q.data(), encoded.data(), q.size() * sizeof(int16_t));
+        if (byte_order != hostByteOrder()) {
+          kernels::byteSwap(q.data(), q.size(), sizeof(int16_t));
+        }
+        dequantize(q.data(), q.size());
+        break;
+      }
+      }
+    }
+
+    /**
+    * Decodes count quantized values straight into the data type of the MetaData, with the double scale and offset.
+    */
+    template <typename Q>
+    void dequantize(const Q* q, size_t count) {
+      clearSparse();
+      if (meta_data_.type_ == VariableDescription_DataType_FLOAT) {
+        data_.resize(count * sizeof(float));
+        kernels::dequantize(q, (float*)data_.data(), count, meta_data_.scale_, meta_data_.offset_);
+      }
+      else {
+        data_.resize(count * sizeof(double));
+        kernels::dequantize(q, (double*)data_.data(), count, meta_data_.scale_, meta_data_.offset_);
+      }
+    }
+
+    /**
+    * Unpacks BIT_PACKED BOOL data into one byte per value. The number of values is taken from the dimensions.
+    */
+    void fromBitPacked(const std::string& packed) {
+      uint64_t count = std::min<uint64_t>(meta_data_.data_length_, packed.size() * 8);
+      data_.resize(count);
+      kernels::unpackBits((const uint8_t*)packed.data(), (uint8_t*)data_.data(), count);
+    }
+
+    template <typename T>
+    void toPackedField(google::protobuf::RepeatedField<T>* field) {
+      int count = (int)(getDataSize() / sizeof(T));
+      field->Resize(count, T());
+      if constexpr (std::is_same<T, bool>::value) {
+        // RAW BOOL bytes may hold any nonzero value, which is not a valid bool.
+        for (int i = 0; i < count; ++i) {
+          field->mutable_data()[i] = bytes()[i] != 0;
+        }
+      }
+      else if (count > 0) {
+        memcpy(field->mutable_data(), bytes(), count * sizeof(T));
+      }
+    }
+  };
+
+  /**
+  * Typed access to the values of a MsgData with a C++ type matching its data type (see DataTypeTraits). The type is
+  * checked once on construction, so the accessors do not need to dispatch on the data type anymore. A TypedMsgData is
+  * a read-only view, it does not copy the MsgData and is only valid as long as the MsgData is alive and not changed.
+  * Obtain the matching TypedMsgData for an arbitrary MsgData with visit(), e.g.
+  * visit(msg.getMetaData().getType(), [&](auto traits) { TypedMsgData<typename decltype(traits)::type> typed(msg); ... });
+  */
+  template <typename T>
+  class TypedMsgData {
+  private:
+    const MsgData* msg_data_;
+    bool valid_;
+
+  public:
+    /**
+    * Constructor for TypedMsgData objects. Invalid if the MsgData is invalid or T does not match its data type.
+    * \param msg_data The MsgData to access, it must outlive the TypedMsgData.
+    */
+    TypedMsgData(const MsgData& msg_data) : msg_data_(&msg_data) {
+      valid_ = msg_data_->valid_ && visit(msg_data_->meta_data_.getType(), [](auto traits) {
+        return std::is_same<typename decltype(traits)::type, T>::value;
+        });
+    }
+
+    // A view on a temporary MsgData would dangle.
+    TypedMsgData(MsgData&&) = delete;
+
+    /**
+    * Returns the number of values stored.
+    */
+    size_t size() const { return msg_data_->getDataSize() / sizeof(T); }
+
+    /**
+    * Returns the value at position i.
+    */
+    T operator[](size_t i) const {
+      T value;
+      memcpy(&value, msg_data_->bytes() + i * sizeof(T), sizeof(T));
+      return value;
+    }
+
+    /**
+    * Copies all values into dst, which must have room for size() values.
+    */
+    void copyTo(T* dst) const {
+      if (size() > 0) {
+        memcpy(dst, msg_data_->bytes(), size() * sizeof(T));
+      }
+    }
+
+    /**
+    * Returns a pointer to the values, see MsgData::getDataPointer. It is 64-byte aligned unless the data is borrowed from
+    * a received frame, which is only guaranteed to be aligned for T.
+    */
+    const T* data() const { return msg_data_->template getDataPointer<T>(); }
+
+    /**
+    * Returns a copy of the values.
+    */
+    std::vector<T> getData() const { return msg_data_->template getData<T>(); }
+
+    bool isValid() const { return valid_; }
   };
 }
\ No newline at end of file
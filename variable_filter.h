@@ -0,0 +1,242 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021-2025 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <google/protobuf/io/coded_stream.h>
+#include "utils.h"
+
+
+namespace tcp_io_device {
+
+  /**
+  * Selects the received variables handed to the consumers of a TCPConnection (see TCPConnection::setVariableFilter).
+  * A variable passes if it is in the set of added (entityID, ID) pairs, or no pair was added, and the predicate (if
+  * any) accepts its MetaData. The decision is taken on the serialized VariableDescription, before the payload is
+  * copied. The predicate is only called once per distinct VariableDescription, its result is cached.
+  * Only used by the background thread of the TCPConnection once it is started.
+  */
+  class VariableFilter {
+  public:
+    /**
+    * Adds a variable to the set of accepted variables.
+    * \param entity_id The entity ID of the variable.
+    * \param id The ID of the variable.
+    */
+    void add(int entity_id, int id) { ids_.insert(key(entity_id, id)); }
+
+    /**
+    * Sets a predicate over the MetaData of the variables, an empty function accepts all variables.
+    */
+    void setPredicate(std::function<bool(const MetaData&)> predicate) {
+      predicate_ = predicate;
+      decisions_.clear();
+    }
+
+    /**
+    * Decides on a variable from its serialized VariableDescription.
+    * \param description The serialized VariableDescription.
+    * \param size The number of bytes of the description.
+    * \return true if the variable passes the filter.
+    */
+    bool accepts(const char* description, size_t size) {
+      int entity_id = 0;
+      int id = 0;
+      if (!readIDs(description, size, entity_id, id)) {
+        // Malformed, let the parser report it.
+        return true;
+      }
+      uint64_t variable = key(entity_id, id);
+      if (!ids_.empty() && ids_.find(variable) == ids_.end()) {
+        filtered_variables_++;
+        return false;
+      }
+      if (!predicate_) {
+        return true;
+      }
+      auto it = decisions_.find(variable);
+      if (it == decisions_.end() || it->second.description.size() != size ||
+        memcmp(it->second.description.data(), description, size) != 0) {
+        VariableDescription parsed;
+        if (!parsed.ParseFromArray(description, (int)size)) {
+          return true;
+        }
+        Decision& decision = decisions_[variable];
+        decision.description.assign(description, size);
+        decision.accepted = predicate_(MetaData(&parsed));
+        it = decisions_.find(variable);
+      }
+      if (!it->second.accepted) {
+        filtered_variables_++;
+      }
+      return it->second.accepted;
+    }
+
+    /**
+    * Decides on a variable from the serialized ProtoVariable.
+    * \param variable The serialized ProtoVariable.
+    * \param size The number of bytes of the variable.
+    * \return true if the variable passes the filter.
+    */
+    bool acceptsVariable(const char* variable, size_t size) {
+      const char* description = NULL;
+      size_t description_size = 0;
+      bool ok = walk(variable, size, [&](uint32_t field, uint64_t /*value*/, const char* bytes, uint32_t length) {
+        if (field == 1 && bytes) {
+          description = bytes;
+          description_size = length;
+        }
+        });
+      // An empty VariableDescription may be omitted.
+      return !ok || accepts(description ? description : variable, description_size);
+    }
+
+    /**
+    * Decides on a variable already parsed by protobuf.
+    * \return true if the variable passes the filter.
+    */
+    bool accepts(const VariableDescription& description) {
+      if (!ids_.empty() && ids_.find(key(description.entityid(), description.id())) == ids_.end()) {
+        filtered_variables_++;
+        return false;
+      }
+      if (predicate_ && !predicate_(MetaData(&description))) {
+        filtered_variables_++;
+        return false;
+      }
+      return true;
+    }
+
+    /**
+    * Returns the number of variables rejected so far.
+    */
+    uint64_t getFilteredVariables() const { return filtered_variables_; }
+
+  private:
+    struct Decision {
+      std::string description;
+      bool accepted;
+    };
+
+    static uint64_t key(int entity_id, int id) { return ((uint64_t)(uint32_t)entity_id << 32) | (uint32_t)id; }
+
+    /**
+    * Reads the entityID (1) and ID (2) of a serialized VariableDescription.
+    * \return false if the bytes are malformed.
+    */
+    static bool readIDs(const char* description, size_t size, int& entity_id, int& id) {
+      return walk(description, size, [&](uint32_t field, uint64_t value, const char* bytes, uint32_t /*length*/) {
+        if (field == 1 && !bytes) {
+          entity_id = (int)(uint32_t)value;
+        }
+        else if (field == 2 && !bytes) {
+          id = (int)(uint32_t)value;
+        }
+        });
+    }
+
+    /**
+    * Walks the fields of a serialized message, calling f(field, value, bytes, length) for varints (bytes is NULL)
+    * and length delimited fields (value is 0).
+    * \return false if the bytes are malformed.
+    */
+    template <typename F>
+    static bool walk(const char* data, size_t size, F&& f) {
+      google::protobuf::io::CodedInputStream input((const uint8_t*)data, (int)size);
+      while (uint32_t tag = input.ReadTag()) {
+        uint64_t value;
+        uint32_t length;
+        switch (tag & 7) {
+        case 0:
+          if (!input.ReadVarint64(&value)) {
+            return false;
+          }
+          f(tag >> 3, value, (const char*)NULL, 0);
+          break;
+        case 1:
+          if (!input.Skip(8)) {
+            return false;
+          }
+          break;
+        case 2:
+          if (!input.ReadVarint32(&length) || length > size - input.CurrentPosition()) {
+            return false;
+          }
+          f(tag >> 3, 0, data + input.CurrentPosition(), length);
+          input.Skip((int)length);
+          break;
+        case 5:
+          if (!input.Skip(4)) {
+            return false;
+          }
+          break;
+        default:
+          return false;
+        }
+      }
+      return input.ConsumedEntireMessage();
+    }
+
+    std::unordered_set<uint64_t> ids_;
+    std::function<bool(const MetaData&)> predicate_;
+    // The predicate results by variable, with the description they were taken on.
+    std::unordered_map<uint64_t, Decision> decisions_;
+    std::atomic<uint64_t> filtered_variables_{ 0 };
+  };
+}
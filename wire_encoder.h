@@ -0,0 +1,303 @@
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//_/_/
+//_/_/ AERA
+//_/_/ Autocatalytic Endogenous Reflective Architecture
+//_/_/ 
+//_/_/ Copyright (c) 2018-2025 Jeff Thompson
+//_/_/ Copyright (c) 2018-2025 Kristinn R. Thorisson
+//_/_/ Copyright (c) 2018-2025 Icelandic Institute for Intelligent Machines
+//_/_/ Copyright (c) 2021-2025 Leonard Eberding
+//_/_/ http://www.iiim.is
+//_/_/
+//_/_/ --- Open-Source BSD License, with CADIA Clause v 1.0 ---
+//_/_/
+//_/_/ Redistribution and use in source and binary forms, with or without
+//_/_/ modification, is permitted provided that the following conditions
+//_/_/ are met:
+//_/_/ - Redistributions of source code must retain the above copyright
+//_/_/   and collaboration notice, this list of conditions and the
+//_/_/   following disclaimer.
+//_/_/ - Redistributions in binary form must reproduce the above copyright
+//_/_/   notice, this list of conditions and the following disclaimer 
+//_/_/   in the documentation and/or other materials provided with 
+//_/_/   the distribution.
+//_/_/
+//_/_/ - Neither the name of its copyright holders nor the names of its
+//_/_/   contributors may be used to endorse or promote products
+//_/_/   derived from this software without specific prior 
+//_/_/   written permission.
+//_/_/   
+//_/_/ - CADIA Clause: The license granted in and to the software 
+//_/_/   under this agreement is a limited-use license. 
+//_/_/   The software may not be used in furtherance of:
+//_/_/    (i)   intentionally causing bodily injury or severe emotional 
+//_/_/          distress to any person;
+//_/_/    (ii)  invading the personal privacy or violating the human 
+//_/_/          rights of any person; or
+//_/_/    (iii) committing or preparing for any act of war.
+//_/_/
+//_/_/ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+//_/_/ CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+//_/_/ INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+//_/_/ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+//_/_/ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+//_/_/ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+//_/_/ SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+//_/_/ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+//_/_/ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+//_/_/ INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+//_/_/ WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+//_/_/ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+//_/_/ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+//_/_/ OF SUCH DAMAGE.
+//_/_/ 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <google/protobuf/io/coded_stream.h>
+#include "utils.h"
+
+
+namespace tcp_io_device {
+
+  /**
+  * Encoder writing DATA TCPMessages straight from MsgData objects into a byte buffer, without building TCPMessage,
+  * ProtoVariable or VariableDescription objects. The output is byte identical to SerializeAsString of the TCPMessage
+  * built with MsgData::toMutableProtoVariable. The nested lengths are computed first, so the bytes are written in a
+  * single pass into the (reused) output buffer.
+  * Variables without extra encoding (RAW, no sparse threshold) are written directly. Variables with another encoding
+  * are converted by toMutableProtoVariable (on a copy of the MsgData) and only their ProtoVariable is serialized.
+  * An encoder is not thread-safe, use one per sending thread.
+  */
+  class WireEncoder {
+  public:
+    /**
+    * Appends a serialized DATA TCPMessage to out, ready for SafeQueue::enqueueEncoded.
+    * \param variables The variables of the DataMessage.
+    * \param time_span The timeSpan of the DataMessage.
+    * \param timestamp The timestamp of the TCPMessage.
+    * \param out The buffer to append to.
+    */
+    void encode(const std::vector<MsgData>& variables, uint64_t time_span, uint64_t timestamp, std::string& out) {
+      size_t size = messageSize(variables, time_span, timestamp);
+      size_t begin = out.size();
+      out.resize(begin + size);
+      uint8_t* pos = (uint8_t*)&out[begin];
+      writeMessage(variables, time_span, timestamp, pos);
+    }
+
+    /**
+    * Appends a DATA TCPMessage with the 8 byte length prefix of the default framing to out, for environments writing
+    * to the socket themselves.
+    * \param variables The variables of the DataMessage.
+    * \param time_span The timeSpan of the DataMessage.
+    * \param timestamp The timestamp of the TCPMessage.
+    * \param out The buffer to append to.
+    */
+    void encodeFrame(const std::vector<MsgData>& variables, uint64_t time_span, uint64_t timestamp, std::string& out) {
+      size_t size = messageSize(variables, time_span, timestamp);
+      size_t begin = out.size();
+      out.resize(begin + 8 + size);
+      uint8_t* pos = (uint8_t*)&out[begin];
+      pos = google::protobuf::io::CodedOutputStream::WriteLittleEndian64ToArray(size, pos);
+      writeMessage(variables, time_span, timestamp, pos);
+    }
+
+    /**
+    * Returns the number of variables written directly.
+    */
+    uint64_t getDirectVariables() { return direct_variables_; }
+
+    /**
+    * Returns the number of variables converted with toMutableProtoVariable.
+    */
+    uint64_t getFallbackVariables() { return fallback_variables_; }
+
+    // Helpers writing the protobuf wire format, shared with CommandTemplate.
+    typedef google::protobuf::io::CodedOutputStream Stream;
+
+    // Wire types of the tags.
+    static constexpr uint8_t VARINT = 0;
+    static constexpr uint8_t FIXED64 = 1;
+    static constexpr uint8_t LENGTH_DELIMITED = 2;
+
+    static constexpr uint8_t tag(int field, uint8_t wire_type) { return (uint8_t)((field << 3) | wire_type); }
+
+    /**
+    * Int32 and enum values are sign extended to 64 bits, negative values take 10 bytes.
+    */
+    static uint64_t int32Value(int32_t value) { return (uint64_t)(int64_t)value; }
+
+    static uint64_t doubleBits(double value) {
+      uint64_t bits;
+      memcpy(&bits, &value, sizeof(bits));
+      return bits;
+    }
+
+    static size_t lengthDelimitedSize(size_t length) { return 1 + Stream::VarintSize64(length) + length; }
+
+    static size_t varintFieldSize(uint64_t value) { return value != 0 ? 1 + Stream::VarintSize64(value) : 0; }
+
+    static uint8_t* writeLengthDelimited(int field, size_t length, uint8_t* pos) {
+      *pos++ = tag(field, LENGTH_DELIMITED);
+      return Stream::WriteVarint64ToArray(length, pos);
+    }
+
+    /**
+    * Writes a varint field, proto3 default values (0) are skipped.
+    */
+    static uint8_t* writeVarintField(int field, uint64_t value, uint8_t* pos) {
+      if (value == 0) {
+        return pos;
+      }
+      *pos++ = tag(field, VARINT);
+      return Stream::WriteVarint64ToArray(value, pos);
+    }
+
+    /**
+    * Writes a double field, skipped if all bits are 0 like in the generated code.
+    */
+    static uint8_t* writeDoubleField(int field, double value, uint8_t* pos) {
+      uint64_t bits = doubleBits(value);
+      if (bits == 0) {
+        return pos;
+      }
+      *pos++ = tag(field, FIXED64);
+      return Stream::WriteLittleEndian64ToArray(bits, pos);
+    }
+
+    static size_t packedDimensionsSize(const MetaData& meta_data) {
+      size_t size = 0;
+      for (uint64_t dimension : meta_data.dimensions_) {
+        size += Stream::VarintSize64(dimension);
+      }
+      return size;
+    }
+
+    /**
+    * Returns the size of the serialized VariableDescription written by MetaData::toMutableVariableDescription.
+    */
+    static size_t descriptionSize(const MetaData& meta_data) {
+      size_t size = varintFieldSize(int32Value(meta_data.entity_id_));
+      size += varintFieldSize(int32Value(meta_data.id_));
+      size += varintFieldSize(int32Value(meta_data.type_));
+      if (!meta_data.dimensions_.empty()) {
+        size += lengthDelimitedSize(packedDimensionsSize(meta_data));
+      }
+      if (!meta_data.opcode_handle_.empty()) {
+        size += lengthDelimitedSize(meta_data.opcode_handle_.size());
+      }
+      size += varintFieldSize(int32Value(meta_data.encoding_));
+      size += doubleBits(meta_data.scale_) != 0 ? 9 : 0;
+      size += doubleBits(meta_data.offset_) != 0 ? 9 : 0;
+      return size;
+    }
+
+    static uint8_t* writeDescription(const MetaData& meta_data, uint8_t* pos) {
+      pos = writeVarintField(1, int32Value(meta_data.entity_id_), pos);
+      pos = writeVarintField(2, int32Value(meta_data.id_), pos);
+      pos = writeVarintField(3, int32Value(meta_data.type_), pos);
+      if (!meta_data.dimensions_.empty()) {
+        pos = writeLengthDelimited(4, packedDimensionsSize(meta_data), pos);
+        for (uint64_t dimension : meta_data.dimensions_) {
+          pos = Stream::WriteVarint64ToArray(dimension, pos);
+        }
+      }
+      if (!meta_data.opcode_handle_.empty()) {
+        pos = writeLengthDelimited(5, meta_data.opcode_handle_.size(), pos);
+        memcpy(pos, meta_data.opcode_handle_.data(), meta_data.opcode_handle_.size());
+        pos += meta_data.opcode_handle_.size();
+      }
+      pos = writeVarintField(6, int32Value(meta_data.encoding_), pos);
+      pos = writeDoubleField(7, meta_data.scale_, pos);
+      pos = writeDoubleField(8, meta_data.offset_, pos);
+      return pos;
+    }
+
+  private:
+    /**
+    * Returns true if the variable is written without conversion, see MsgData::toMutableProtoVariable.
+    */
+    static bool isDirect(const MsgData& var) {
+      return var.meta_data_.encoding_ == VariableDescription_Encoding_RAW && !(var.meta_data_.sparse_threshold_ > 0);
+    }
+
+    /**
+    * Computes and stores the sizes of the serialized ProtoVariables, converts the variables which are not written
+    * directly, and returns the size of the serialized TCPMessage.
+    */
+    size_t messageSize(const std::vector<MsgData>& variables, uint64_t time_span, uint64_t timestamp) {
+      variable_sizes_.resize(variables.size());
+      description_sizes_.resize(variables.size());
+      if (fallback_.size() < variables.size()) {
+        fallback_.resize(variables.size());
+      }
+      size_t data_message_size = 0;
+      for (size_t i = 0; i < variables.size(); ++i) {
+        const MsgData& var = variables[i];
+        size_t size;
+        if (isDirect(var)) {
+          size_t data_size = var.getDataSize();
+          description_sizes_[i] = descriptionSize(var.meta_data_);
+          size = lengthDelimitedSize(description_sizes_[i]);
+          size += data_size != 0 ? lengthDelimitedSize(data_size) : 0;
+          fallback_[i].clear();
+          direct_variables_++;
+        }
+        else {
+          MsgData copy = var;
+          proto_variable_.Clear();
+          copy.toMutableProtoVariable(&proto_variable_);
+          proto_variable_.SerializeToString(&fallback_[i]);
+          size = fallback_[i].size();
+          fallback_variables_++;
+        }
+        variable_sizes_[i] = size;
+        data_message_size += lengthDelimitedSize(size);
+      }
+      data_message_size += varintFieldSize(time_span);
+      data_message_size_ = data_message_size;
+      return 2 + lengthDelimitedSize(data_message_size) + varintFieldSize(timestamp);
+    }
+
+    /**
+    * Writes the TCPMessage measured by the last call of messageSize.
+    */
+    void writeMessage(const std::vector<MsgData>& variables, uint64_t time_span, uint64_t timestamp, uint8_t* pos) {
+      pos = writeVarintField(1, TCPMessage_Type_DATA, pos);
+      pos = writeLengthDelimited(3, data_message_size_, pos);
+      for (size_t i = 0; i < variables.size(); ++i) {
+        const MsgData& var = variables[i];
+        pos = writeLengthDelimited(1, variable_sizes_[i], pos);
+        if (!isDirect(var)) {
+          memcpy(pos, fallback_[i].data(), fallback_[i].size());
+          pos += fallback_[i].size();
+          continue;
+        }
+        pos = writeLengthDelimited(1, description_sizes_[i], pos);
+        pos = writeDescription(var.meta_data_, pos);
+        size_t data_size = var.getDataSize();
+        if (data_size != 0) {
+          pos = writeLengthDelimited(2, data_size, pos);
+          memcpy(pos, var.bytes(), data_size);
+          pos += data_size;
+        }
+      }
+      pos = writeVarintField(2, time_span, pos);
+      writeVarintField(6, timestamp, pos);
+    }
+
+    // Sizes of the serialized ProtoVariables and VariableDescriptions of the current message.
+    std::vector<size_t> variable_sizes_;
+    std::vector<size_t> description_sizes_;
+    // Serialized ProtoVariables of the variables not written directly, empty for the others.
+    std::vector<std::string> fallback_;
+    ProtoVariable proto_variable_;
+    size_t data_message_size_ = 0;
+    uint64_t direct_variables_ = 0;
+    uint64_t fallback_variables_ = 0;
+  };
+}